@@ -0,0 +1,104 @@
+// MIT License
+// 
+// Copyright (c) 2025 Mr. Myxa
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+namespace bench_utils
+{
+    // Plain data, copied and relocated with memcpy
+    using Trivial = std::uint64_t;
+
+    // Owns a handle: moves are user provided and reset the source, copies are deleted
+    class MoveOnly
+    {
+    public:
+        MoveOnly() noexcept = default;
+
+        explicit MoveOnly(std::uint64_t value) noexcept
+            : mValue{ value }
+        { }
+
+        MoveOnly(MoveOnly&& rhs) noexcept
+            : mValue{ std::exchange(rhs.mValue, 0) }
+        { }
+
+        MoveOnly& operator=(MoveOnly&& rhs) noexcept
+        {
+            mValue = std::exchange(rhs.mValue, 0);
+            return *this;
+        }
+
+        MoveOnly(const MoveOnly&) = delete;
+        MoveOnly& operator=(const MoveOnly&) = delete;
+
+        std::uint64_t value() const noexcept { return mValue; }
+
+        friend bool operator==(const MoveOnly&, const MoveOnly&) noexcept = default;
+
+    private:
+        std::uint64_t mValue{};
+    };
+
+    // Long enough to live on the heap past any small string buffer
+    using HeapOwning = std::string;
+
+    template <typename T>
+    T make_value(std::uint64_t i)
+    {
+        if constexpr (std::is_same_v<T, HeapOwning>)
+        {
+            return HeapOwning(32, static_cast<char>('a' + i % 26));
+        }
+        else 
+        {
+            return T(i);
+        }
+    }
+
+    template <typename T>
+    std::uint64_t key(const T& value) noexcept
+    {
+        if constexpr (std::is_same_v<T, Trivial>) { return value; }
+        else if constexpr (std::is_same_v<T, MoveOnly>) { return value.value(); }
+        else { return static_cast<std::uint64_t>(value.front()); }
+    }
+
+    template <typename Vec>
+    Vec make_filled(std::size_t n)
+    {
+        Vec vec{};
+        vec.reserve(n);
+
+        for (std::size_t i{}; i < n; ++i)
+        {
+            vec.push_back(make_value<typename Vec::value_type>(i));
+        }
+
+        return vec;
+    }
+} // namespace bench_utils
@@ -0,0 +1,220 @@
+// MIT License
+// 
+// Copyright (c) 2025 Mr. Myxa
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include <benchmark/benchmark.h>
+
+#include "../headers/vectorx.hpp"
+#include "utils/bench_utils.hpp"
+
+#include <vector>
+
+using namespace bench_utils;
+
+namespace
+{
+    enum class Position { Front, Middle, Back };
+
+    constexpr std::size_t index_at(Position pos, std::size_t size) noexcept
+    {
+        switch (pos)
+        {
+            case Position::Front: return 0;
+            case Position::Middle: return size / 2;
+            default: return size;
+        }
+    }
+
+    template <typename Vec>
+    void BM_PushBack(benchmark::State& state)
+    {
+        using T = typename Vec::value_type;
+        const auto n{ static_cast<std::size_t>(state.range(0)) };
+
+        for (auto _ : state)
+        {
+            Vec vec{};
+            for (std::size_t i{}; i < n; ++i)
+            {
+                vec.push_back(make_value<T>(i));
+            }
+
+            benchmark::DoNotOptimize(vec.data());
+        }
+
+        state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * n));
+    }
+
+    template <typename Vec>
+    void BM_PushBackReserved(benchmark::State& state)
+    {
+        using T = typename Vec::value_type;
+        const auto n{ static_cast<std::size_t>(state.range(0)) };
+
+        for (auto _ : state)
+        {
+            Vec vec{};
+            vec.reserve(n);
+
+            for (std::size_t i{}; i < n; ++i)
+            {
+                vec.push_back(make_value<T>(i));
+            }
+
+            benchmark::DoNotOptimize(vec.data());
+        }
+
+        state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * n));
+    }
+
+    template <typename Vec>
+    void BM_Resize(benchmark::State& state)
+    {
+        const auto n{ static_cast<std::size_t>(state.range(0)) };
+
+        for (auto _ : state)
+        {
+            Vec vec{};
+            vec.resize(n);
+
+            benchmark::DoNotOptimize(vec.data());
+        }
+
+        state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * n));
+    }
+
+    // One insert and the matching erase per iteration keeps the size fixed
+    template <typename Vec, Position Pos>
+    void BM_InsertErase(benchmark::State& state)
+    {
+        using T = typename Vec::value_type;
+        const auto n{ static_cast<std::size_t>(state.range(0)) };
+        
+        Vec vec{ make_filled<Vec>(n) };
+        vec.reserve(n + 1);
+
+        const auto idx{ index_at(Pos, n) };
+        for (auto _ : state)
+        {
+            vec.emplace(vec.begin() + idx, make_value<T>(idx));
+            vec.erase(vec.begin() + idx);
+
+            benchmark::DoNotOptimize(vec.data());
+        }
+    }
+
+    template <typename Vec>
+    void BM_Copy(benchmark::State& state)
+    {
+        const auto n{ static_cast<std::size_t>(state.range(0)) };
+        const Vec src{ make_filled<Vec>(n) };
+
+        for (auto _ : state)
+        {
+            Vec copy{ src };
+            benchmark::DoNotOptimize(copy.data());
+        }
+
+        state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * n));
+    }
+
+    template <typename Vec>
+    void BM_Move(benchmark::State& state)
+    {
+        Vec src{ make_filled<Vec>(static_cast<std::size_t>(state.range(0))) };
+
+        for (auto _ : state)
+        {
+            Vec moved{ std::move(src) };
+            benchmark::DoNotOptimize(moved.data());
+
+            src = std::move(moved);
+        }
+    }
+
+    template <typename Vec>
+    void BM_Iterate(benchmark::State& state)
+    {
+        const auto n{ static_cast<std::size_t>(state.range(0)) };
+        const Vec vec{ make_filled<Vec>(n) };
+
+        for (auto _ : state)
+        {
+            std::uint64_t sum{};
+            for (const auto& el : vec)
+            {
+                sum += key(el);
+            }
+
+            benchmark::DoNotOptimize(sum);
+        }
+
+        state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * n));
+    }
+
+    // Equal contents force a full scan
+    template <typename Vec>
+    void BM_Compare(benchmark::State& state)
+    {
+        const auto n{ static_cast<std::size_t>(state.range(0)) };
+        const Vec lhs{ make_filled<Vec>(n) };
+        const Vec rhs{ make_filled<Vec>(n) };
+
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(lhs == rhs);
+        }
+
+        state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * n));
+    }
+
+    constexpr std::int64_t trivial_max{ 100'000'000 };
+    // Non trivial elements are capped lower, 100M strings alone take several GB
+    constexpr std::int64_t object_max{ 16'000'000 };
+    // Every iteration shifts the whole tail
+    constexpr std::int64_t shifting_max{ 1'000'000 };
+} // namespace
+
+#define VECTORX_BENCHMARK_PAIR(func, T, max, ...) \
+    BENCHMARK_TEMPLATE(func, std::vector<T> __VA_OPT__(,) __VA_ARGS__)->RangeMultiplier(16)->Range(16, max); \
+    BENCHMARK_TEMPLATE(func, vectorx::vector<T> __VA_OPT__(,) __VA_ARGS__)->RangeMultiplier(16)->Range(16, max)
+
+#define VECTORX_BENCHMARK_MOVABLE(T, max) \
+    VECTORX_BENCHMARK_PAIR(BM_PushBack, T, max); \
+    VECTORX_BENCHMARK_PAIR(BM_PushBackReserved, T, max); \
+    VECTORX_BENCHMARK_PAIR(BM_Resize, T, max); \
+    VECTORX_BENCHMARK_PAIR(BM_InsertErase, T, std::min(max, shifting_max), Position::Front); \
+    VECTORX_BENCHMARK_PAIR(BM_InsertErase, T, std::min(max, shifting_max), Position::Middle); \
+    VECTORX_BENCHMARK_PAIR(BM_InsertErase, T, max, Position::Back); \
+    VECTORX_BENCHMARK_PAIR(BM_Move, T, max); \
+    VECTORX_BENCHMARK_PAIR(BM_Iterate, T, max); \
+    VECTORX_BENCHMARK_PAIR(BM_Compare, T, max)
+
+VECTORX_BENCHMARK_MOVABLE(Trivial, trivial_max);
+VECTORX_BENCHMARK_PAIR(BM_Copy, Trivial, trivial_max);
+
+VECTORX_BENCHMARK_MOVABLE(MoveOnly, object_max);
+
+VECTORX_BENCHMARK_MOVABLE(HeapOwning, object_max);
+VECTORX_BENCHMARK_PAIR(BM_Copy, HeapOwning, object_max);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,230 @@
+// MIT License
+// 
+// Copyright (c) 2025 Mr. Myxa
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#pragma once
+
+#include <atomic>
+
+#include "segmented_vector.hpp"
+
+namespace vectorx
+{
+    // Segmented storage that many threads can append to without a lock. Elements never move, so readers
+    // holding an index, reference or iterator are never invalidated by concurrent growth.
+    //
+    // Safe to run concurrently: push_back, emplace_back, grow_by, reserve, operator[], size and iteration.
+    // An element may only be read once its writer has published it (e.g. by the caller's own synchronization);
+    // size() counts claimed slots, some of which may still be under construction.
+    // clear, destruction and swap need exclusive access.
+    template <typename T, 
+              std::size_t FirstSegment = detail::default_first_segment<T>, 
+              typename Alloc = std::allocator<T>>
+        requires std::is_nothrow_move_constructible_v<T>
+    class concurrent_vector
+    {
+        using layout = detail::SegmentLayout<FirstSegment>;
+
+    public:
+        using value_type = T;
+        using allocator_type = Alloc;
+        using size_type = std::size_t;
+        using difference_type = std::ptrdiff_t;
+        using reference = value_type&;
+        using const_reference = const value_type&;
+        using iterator = detail::IndexedIterator<concurrent_vector, T>;
+        using const_iterator = detail::IndexedIterator<const concurrent_vector, const T>;
+
+        using alloc_traits = std::allocator_traits<Alloc>;
+
+    public:
+        // Nothrow
+        concurrent_vector() = default;
+
+        // Nothrow if alloc nothrow. The allocator is called concurrently and must be thread safe.
+        explicit concurrent_vector(const Alloc& alloc)
+            : mAlloc{ alloc }
+        { }
+
+        concurrent_vector(const concurrent_vector&) = delete;
+        concurrent_vector& operator=(const concurrent_vector&) = delete;
+
+        // Nothrow
+        ~concurrent_vector() noexcept
+        {
+            clear();
+
+            for (std::size_t segment{}; segment < layout::max_segments; ++segment)
+            {
+                if (T* first{ mSegments[segment].load(std::memory_order_relaxed) }; first != nullptr)
+                {
+                    alloc_traits::deallocate(mAlloc, first, layout::segment_capacity(segment));
+                }
+            }
+        }
+
+        // Nothrow
+        allocator_type get_allocator() const noexcept { return mAlloc; }
+
+        // Nothrow
+        size_type size() const noexcept { return mSize.load(std::memory_order_acquire); }
+        bool empty() const noexcept { return size() == 0; }
+
+        // Nothrow
+        reference operator[](std::size_t index) noexcept { return *locate(index); }
+        const_reference operator[](std::size_t index) const noexcept { return *locate(index); }
+
+        iterator begin() noexcept { return iterator{ this, 0 }; }
+        const_iterator begin() const noexcept { return const_iterator{ this, 0 }; }
+        const_iterator cbegin() const noexcept { return begin(); }
+
+        iterator end() noexcept { return iterator{ this, size() }; }
+        const_iterator end() const noexcept { return const_iterator{ this, size() }; }
+        const_iterator cend() const noexcept { return end(); }
+
+        // Strong, allocates the segments needed for `capacity` elements
+        void reserve(size_type capacity)
+        {
+            if (const auto sz{ size() }; capacity > sz) { allocate_segments(sz, capacity); }
+        }
+
+        // Strong
+        iterator push_back(const T& value)
+        {
+            return emplace(value);
+        }
+
+        // Strong
+        iterator push_back(T&& value)
+        {
+            return emplace(std::move(value));
+        }
+
+        // Strong
+        template <typename... Args>
+        reference emplace_back(Args&&... args)
+        {
+            return *emplace(std::forward<Args>(args)...);
+        }
+
+        // Strong. Claims n consecutive slots and value-initializes them, returns an iterator to the first one
+        iterator grow_by(size_type n)
+            requires std::is_nothrow_default_constructible_v<T>
+        {
+            return grow_with(n, [](T* location) { std::construct_at(location); });
+        }
+
+        // Strong. Claims n consecutive slots holding copies of value, returns an iterator to the first one
+        iterator grow_by(size_type n, const T& value)
+            requires std::is_nothrow_copy_constructible_v<T>
+        {
+            return grow_with(n, [&value](T* location) { std::construct_at(location, value); });
+        }
+
+        // Nothrow, keeps the segments. Needs exclusive access.
+        void clear() noexcept
+        {
+            const auto sz{ mSize.load(std::memory_order_relaxed) };
+
+            for (std::size_t segment{}; segment < layout::max_segments && layout::segment_offset(segment) < sz; ++segment)
+            {
+                const auto count{ std::min(sz - layout::segment_offset(segment), layout::segment_capacity(segment)) };
+                std::destroy_n(mSegments[segment].load(std::memory_order_relaxed), count);
+            }
+
+            mSize.store(0, std::memory_order_relaxed);
+        }
+
+    private:
+        T* locate(size_type index) const noexcept
+        {
+            const auto segment{ layout::segment_of(index) };
+            return mSegments[segment].load(std::memory_order_acquire) + (index - layout::segment_offset(segment));
+        }
+
+        // Strong. Every size ever published is covered by allocated segments, so [0, size) never needs checking.
+        void allocate_segments(size_type size, size_type end)
+        {
+            const auto last{ layout::segment_of(end - 1) };
+            if (end < size || last >= layout::max_segments) { throw std::length_error{ "vectorx::concurrent_vector too large" }; }
+
+            for (auto segment{ size == 0 ? 0 : layout::segment_of(size - 1) }; segment <= last; ++segment)
+            {
+                if (mSegments[segment].load(std::memory_order_acquire) != nullptr) { continue; }
+
+                T* fresh{ alloc_traits::allocate(mAlloc, layout::segment_capacity(segment)) };
+                T* expected{ nullptr };
+
+                if (!mSegments[segment].compare_exchange_strong(expected, fresh, std::memory_order_acq_rel, std::memory_order_acquire))
+                {
+                    alloc_traits::deallocate(mAlloc, fresh, layout::segment_capacity(segment)); // another thread won
+                }
+            }
+        }
+
+        // Strong. Segments are allocated before the slots are claimed, so nothing past this can throw.
+        size_type claim(size_type n)
+        {
+            auto first{ mSize.load(std::memory_order_relaxed) };
+
+            do
+            {
+                allocate_segments(first, first + n);
+            }
+            while (!mSize.compare_exchange_weak(first, first + n, std::memory_order_acq_rel, std::memory_order_relaxed));
+
+            return first;
+        }
+
+        // Strong, the value is built before a slot is claimed and moved in afterwards
+        template <typename... Args>
+        iterator emplace(Args&&... args)
+        {
+            T value(std::forward<Args>(args)...);
+            const auto index{ claim(1) };
+
+            std::construct_at(locate(index), std::move(value));
+            return iterator{ this, index };
+        }
+
+        template <typename Construct>
+        iterator grow_with(size_type n, Construct&& construct)
+        {
+            if (n == 0) { return end(); }
+
+            const auto first{ claim(n) };
+            for (auto index{ first }; index < first + n; ++index)
+            {
+                construct(locate(index));
+            }
+
+            return iterator{ this, first };
+        }
+
+    private:
+        [[no_unique_address]] Alloc mAlloc{};
+
+        std::atomic<T*> mSegments[layout::max_segments]{};
+        alignas(64) std::atomic<size_type> mSize{}; // own cache line, it's what every appender hammers
+    };
+
+} // namespace vectorx
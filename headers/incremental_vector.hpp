@@ -0,0 +1,300 @@
+// MIT License
+// 
+// Copyright (c) 2025 Mr. Myxa
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#pragma once
+
+#include "vectorx.hpp"
+
+namespace vectorx
+{
+    // Vector whose growth doesn't stop the world: crossing capacity swaps in a block twice as large and every
+    // following push_back relocates the next MigrationStep elements out of the old one. Doubling leaves room for
+    // as many pushes as the old block held, so the migration always ends before the new block fills up.
+    // While it runs, index i lives in the old block iff i is in [migrated, old size).
+    template <typename T, std::size_t MigrationStep = 16, typename Alloc = std::allocator<T>>
+        requires std::is_nothrow_move_constructible_v<T> && (MigrationStep > 0)
+    class incremental_vector
+    {
+    public:
+        using value_type = T;
+        using allocator_type = Alloc;
+        using size_type = std::size_t;
+        using difference_type = std::ptrdiff_t;
+        using reference = value_type&;
+        using const_reference = const value_type&;
+        using iterator = detail::IndexedIterator<incremental_vector, T>;
+        using const_iterator = detail::IndexedIterator<const incremental_vector, const T>;
+
+        using buffer_t = detail::Buffer<T, Alloc>;
+        
+        static constexpr std::size_t migration_step{ MigrationStep };
+
+    public:
+        // Nothrow
+        incremental_vector() = default;
+
+        // Nothrow if alloc nothrow
+        explicit incremental_vector(const Alloc& alloc)
+            : mBuffer{ alloc }
+            , mOld{ alloc }
+        { }
+
+        // Strong
+        incremental_vector(std::initializer_list<T> list, const Alloc& alloc = Alloc{})
+            : incremental_vector(alloc)
+        {
+            reserve(std::size(list));
+
+            for (const auto& el : list)
+            {
+                emplace_back(el);
+            }
+        }
+
+        // Strong, the copy is contiguous
+        incremental_vector(const incremental_vector& rhs)
+            : incremental_vector(std::allocator_traits<Alloc>::select_on_container_copy_construction(rhs.get_allocator()))
+        {
+            reserve(rhs.mSize);
+
+            for (const auto& el : rhs)
+            {
+                emplace_back(el);
+            }
+        }
+
+        // Nothrow
+        incremental_vector(incremental_vector&& rhs) noexcept
+            : mBuffer{ std::move(rhs.mBuffer) }
+            , mOld{ std::move(rhs.mOld) }
+            , mSize{ std::exchange(rhs.mSize, 0) }
+            , mOldSize{ std::exchange(rhs.mOldSize, 0) }
+            , mMigrated{ std::exchange(rhs.mMigrated, 0) }
+        { }
+
+        // Strong
+        incremental_vector& operator=(const incremental_vector& rhs)
+        {
+            if (this != &rhs)
+            {
+                incremental_vector copy(rhs);
+                swap(*this, copy);
+            }
+
+            return *this;
+        }
+
+        // Nothrow
+        incremental_vector& operator=(incremental_vector&& rhs) noexcept
+        {
+            if (this != &rhs)
+            {
+                incremental_vector released(std::move(*this));
+                swap(*this, rhs);
+            }
+
+            return *this;
+        }
+
+        // Nothrow
+        ~incremental_vector() noexcept
+        {
+            destroy_all();
+        }
+
+        // Nothrow
+        allocator_type get_allocator() const noexcept { return mBuffer.get_allocator(); }
+
+        // Nothrow
+        size_type size() const noexcept { return mSize; }
+        size_type capacity() const noexcept { return mBuffer.capacity(); }
+        bool empty() const noexcept { return mSize == 0; }
+
+        // Nothrow. True while elements are still spread over two blocks
+        bool is_migrating() const noexcept { return mMigrated != mOldSize; }
+
+        // Strong
+        reference operator[](std::size_t index) { return *locate(index); }
+        const_reference operator[](std::size_t index) const { return *locate(index); }
+
+        iterator begin() noexcept { return iterator{ this, 0 }; }
+        const_iterator begin() const noexcept { return const_iterator{ this, 0 }; }
+        const_iterator cbegin() const noexcept { return begin(); }
+
+        iterator end() noexcept { return iterator{ this, mSize }; }
+        const_iterator end() const noexcept { return const_iterator{ this, mSize }; }
+        const_iterator cend() const noexcept { return end(); }
+
+        // Strong. Finishes a pending migration and then relocates at once, for callers that pick the pause themselves.
+        void reserve(size_type capacity)
+        {
+            if (capacity <= this->capacity()) { return; }
+
+            buffer_t next{ capacity, get_allocator() };
+            finish_migration();
+
+            detail::uninitialized_relocate_n(mBuffer.data(), mSize, next.data());
+            swap(mBuffer, next);
+        }
+
+        // Nothrow
+        void finish_migration() noexcept
+        {
+            migrate(mOldSize - mMigrated);
+        }
+
+        // Strong
+        void push_back(const T& value)
+        {
+            emplace_back(value);
+        }
+
+        // Strong
+        void push_back(T&& value)
+        {
+            emplace_back(std::move(value));
+        }
+
+        // Strong, at most MigrationStep elements are relocated per call
+        template <typename... Args>
+        reference emplace_back(Args&&... args)
+        {
+            if (mSize == capacity()) { return grow_and_emplace(std::forward<Args>(args)...); }
+
+            T* location{ std::construct_at(mBuffer.data(mSize), std::forward<Args>(args)...) };
+            ++mSize;
+
+            migrate(std::min(MigrationStep, mOldSize - mMigrated));
+            return *location;
+        }
+
+        // Nothrow
+        void pop_back() noexcept
+        {
+            std::destroy_at(locate(--mSize));
+
+            if (mSize < mOldSize) // the popped element came from the old block's range
+            {
+                mOldSize = mSize;
+                if (mMigrated >= mOldSize) { release_old(); }
+            }
+        }
+
+        // Nothrow, keeps the capacity
+        void clear() noexcept
+        {
+            destroy_all();
+            release_old();
+
+            mSize = 0;
+        }
+
+        friend bool operator==(const incremental_vector& lhs, const incremental_vector& rhs)
+        {
+            return lhs.mSize == rhs.mSize && std::equal(lhs.begin(), lhs.end(), rhs.begin());
+        }
+
+        friend bool operator!=(const incremental_vector& lhs, const incremental_vector& rhs)
+        {
+            return !(lhs == rhs);
+        }
+
+        // Nothrow
+        friend void swap(incremental_vector& lhs, incremental_vector& rhs) noexcept
+        {
+            using std::swap;
+
+            swap(lhs.mBuffer, rhs.mBuffer);
+            swap(lhs.mOld, rhs.mOld);
+            swap(lhs.mSize, rhs.mSize);
+            swap(lhs.mOldSize, rhs.mOldSize);
+            swap(lhs.mMigrated, rhs.mMigrated);
+        }
+
+    private:
+        // Nothrow
+        T* locate(size_type index) const noexcept
+        {
+            // One unsigned compare covers both bounds of [mMigrated, mOldSize)
+            if (index - mMigrated < mOldSize - mMigrated) { return const_cast<T*>(mOld.data(index)); }
+            return const_cast<T*>(mBuffer.data(index));
+        }
+
+        // Strong, swaps in a doubled block and makes the current one the migration source. The new element is
+        // built before anything is relocated or freed, as args may refer to an element.
+        template <typename... Args>
+        reference grow_and_emplace(Args&&... args)
+        {
+            buffer_t next{ growth::doubling::next_capacity(capacity(), mSize + 1, sizeof(T)), get_allocator() };
+            T* location{ std::construct_at(next.data(mSize), std::forward<Args>(args)...) };
+            
+            finish_migration(); // only left over after pop_back/reserve juggling
+
+            swap(mBuffer, next);
+            mOld = std::move(next);
+
+            mOldSize = mSize;
+            mMigrated = 0;
+            ++mSize;
+
+            migrate(std::min(MigrationStep, mOldSize)); // small blocks move over at once
+            return *location;
+        }
+
+        // Nothrow, relocates the next count elements of the old block
+        void migrate(size_type count) noexcept
+        {
+            if (count == 0) { return; }
+
+            detail::uninitialized_relocate_n(mOld.data(mMigrated), count, mBuffer.data(mMigrated));
+            mMigrated += count;
+
+            if (!is_migrating()) { release_old(); }
+        }
+
+        // Nothrow
+        void release_old() noexcept
+        {
+            mOld = buffer_t{ get_allocator() };
+            mOldSize = 0;
+            mMigrated = 0;
+        }
+
+        // Nothrow
+        void destroy_all() noexcept
+        {
+            std::destroy_n(mBuffer.data(), mMigrated);
+            std::destroy(mOld.data(mMigrated), mOld.data(mOldSize));
+            std::destroy(mBuffer.data(mOldSize), mBuffer.data(mSize));
+        }
+
+    private:
+        buffer_t mBuffer;
+        buffer_t mOld;
+
+        size_type mSize{};
+        size_type mOldSize{};  // elements the old block held when the migration started
+        size_type mMigrated{}; // prefix of them already in mBuffer
+    };
+
+} // namespace vectorx
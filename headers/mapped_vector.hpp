@@ -0,0 +1,765 @@
+// MIT License
+// 
+// Copyright (c) 2025 Mr. Myxa
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#pragma once
+
+#include <cerrno>
+#include <cstdint>
+#include <filesystem>
+#include <stdexcept>
+#include <system_error>
+
+#include "vectorx.hpp"
+
+#if defined(__linux__)
+#include <fcntl.h>
+#include <sys/stat.h>
+#endif
+
+namespace vectorx
+{
+    enum class file_mode
+    {
+        open_or_create, // keeps the elements already in the file
+        truncate        // starts from an empty file
+    };
+
+    namespace detail
+    {
+        // Shared read-write mapping of a whole file, the file size is the mapping size
+        class MappedFile
+        {
+        public:
+            static_assert(pages::is_supported, "file mappings need mmap/mremap");
+
+            // Throws std::system_error
+            MappedFile(const std::filesystem::path& path, file_mode mode)
+            {
+#if defined(__linux__)
+                const int flags{ O_RDWR | O_CREAT | O_CLOEXEC | (mode == file_mode::truncate ? O_TRUNC : 0) };
+
+                mFd = ::open(path.c_str(), flags, 0644);
+                if (mFd == -1) { throw_errno("vectorx: can't open mapped file"); }
+
+                struct stat st{};
+                if (::fstat(mFd, &st) == -1)
+                {
+                    const int err{ errno };
+                    ::close(mFd);
+                    throw std::system_error{ err, std::generic_category(), "vectorx: can't stat mapped file" };
+                }
+
+                try
+                {
+                    map(static_cast<std::size_t>(st.st_size));
+                }
+                catch (...)
+                {
+                    ::close(mFd);
+                    throw;
+                }
+#endif
+            }
+
+            MappedFile(const MappedFile&) = delete;
+            MappedFile& operator=(const MappedFile&) = delete;
+
+            MappedFile(MappedFile&& rhs) noexcept
+                : mFd{ std::exchange(rhs.mFd, -1) }
+                , mData{ std::exchange(rhs.mData, nullptr) }
+                , mSize{ std::exchange(rhs.mSize, 0) }
+            { }
+
+            MappedFile& operator=(MappedFile&& rhs) noexcept
+            {
+                if (this != &rhs)
+                {
+                    close();
+
+                    mFd = std::exchange(rhs.mFd, -1);
+                    mData = std::exchange(rhs.mData, nullptr);
+                    mSize = std::exchange(rhs.mSize, 0);
+                }
+
+                return *this;
+            }
+
+            ~MappedFile() noexcept
+            {
+                close();
+            }
+
+            std::byte* data() const noexcept { return mData; }
+            std::size_t size() const noexcept { return mSize; }
+
+            // Strong, throws std::system_error. Extends or truncates the file and remaps it, the mapping may move.
+            void resize(std::size_t bytes)
+            {
+#if defined(__linux__)
+                if (bytes == mSize) { return; }
+
+                if (::ftruncate(mFd, static_cast<off_t>(bytes)) == -1) { throw_errno("vectorx: can't resize mapped file"); }
+
+                if (mSize == 0 || bytes == 0)
+                {
+                    unmap();
+                    map(bytes);
+                    return;
+                }
+
+                void* ptr{ ::mremap(mData, mSize, bytes, MREMAP_MAYMOVE) };
+                if (ptr == MAP_FAILED)
+                {
+                    const int err{ errno };
+                    (void)::ftruncate(mFd, static_cast<off_t>(mSize));
+                    throw std::system_error{ err, std::generic_category(), "vectorx: can't remap file" };
+                }
+
+                mData = static_cast<std::byte*>(ptr);
+                mSize = bytes;
+#else
+                (void)bytes;
+#endif
+            }
+
+            // Throws std::system_error. Blocks until dirty pages are written back.
+            void sync() const
+            {
+#if defined(__linux__)
+                if (mSize != 0 && ::msync(mData, mSize, MS_SYNC) == -1) { throw_errno("vectorx: can't sync mapped file"); }
+#endif
+            }
+
+        private:
+            [[noreturn]] static void throw_errno(const char* what)
+            {
+                throw std::system_error{ errno, std::generic_category(), what };
+            }
+
+            void map(std::size_t bytes)
+            {
+#if defined(__linux__)
+                if (bytes != 0)
+                {
+                    void* ptr{ ::mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, mFd, 0) };
+                    if (ptr == MAP_FAILED) { throw_errno("vectorx: can't map file"); }
+
+                    mData = static_cast<std::byte*>(ptr);
+                }
+
+                mSize = bytes;
+#else
+                (void)bytes;
+#endif
+            }
+
+            void unmap() noexcept
+            {
+#if defined(__linux__)
+                if (mData != nullptr) { ::munmap(mData, mSize); }
+#endif
+                mData = nullptr;
+                mSize = 0;
+            }
+
+            void close() noexcept
+            {
+                unmap();
+#if defined(__linux__)
+                if (mFd != -1) { ::close(mFd); }
+#endif
+                mFd = -1;
+            }
+
+        private:
+            int mFd{ -1 };
+            std::byte* mData{};
+            std::size_t mSize{};
+        };
+
+        // On-disk layout: this header, then the elements up to the end of the file. count is rewritten on every
+        // size change through the shared mapping, so it stays exact when the process dies without closing.
+        struct MappedHeader
+        {
+            static constexpr std::uint64_t magic_value{ 0x3130'4345'5650'414D }; // "MAPVEC01" little endian
+            static constexpr std::uint32_t current_version{ 1 };
+            static constexpr std::uint32_t endian_tag{ 0x0102'0304 };
+
+            std::uint64_t magic{ magic_value };
+            std::uint32_t version{ current_version };
+            std::uint32_t endian{ endian_tag };
+            std::uint32_t value_size{};
+            std::uint32_t value_align{};
+            std::uint64_t count{};
+            std::byte reserved[32]{};
+        };
+
+        static_assert(sizeof(MappedHeader) == 64 && std::is_trivially_copyable_v<MappedHeader>);
+    } // namespace detail
+
+    // Vector of trivially copyable elements living in a shared file mapping. The file holds a header with the
+    // element count, then the raw elements: growth extends it and remaps, closing trims the unused capacity.
+    template <typename T, growth::policy GrowthPolicy = growth::doubling>
+        requires std::is_trivially_copyable_v<T> && (alignof(T) <= sizeof(detail::MappedHeader))
+    class mapped_vector
+    {
+    public:
+        using value_type = T;
+        using growth_policy = GrowthPolicy;
+        using size_type = std::size_t;
+        using difference_type = std::ptrdiff_t;
+        using reference = value_type&;
+        using const_reference = const value_type&;
+        using pointer = T*;
+        using const_pointer = const T*;
+        using iterator = T*;
+        using const_iterator = const T*;
+
+        // Bytes before the first element, the mapping is page aligned so elements are aligned too
+        static constexpr std::size_t data_offset{ sizeof(detail::MappedHeader) };
+
+    public:
+        // Throws std::system_error, or std::runtime_error if the file isn't a mapped_vector of T
+        explicit mapped_vector(const std::filesystem::path& path, file_mode mode = file_mode::open_or_create)
+            : mFile{ path, mode }
+        {
+            if (mFile.size() == 0)
+            {
+                mFile.resize(data_offset);
+
+                auto* header{ std::construct_at(reinterpret_cast<detail::MappedHeader*>(mFile.data())) };
+                header->value_size = sizeof(T);
+                header->value_align = alignof(T);
+            }
+
+            mCapacity = (mFile.size() - std::min(mFile.size(), data_offset)) / sizeof(T);
+
+            validate();
+            mSize = static_cast<size_type>(header().count);
+        }
+
+        mapped_vector(const mapped_vector&) = delete;
+        mapped_vector& operator=(const mapped_vector&) = delete;
+
+        // Nothrow
+        mapped_vector(mapped_vector&& rhs) noexcept
+            : mFile{ std::move(rhs.mFile) }
+            , mSize{ std::exchange(rhs.mSize, 0) }
+            , mCapacity{ std::exchange(rhs.mCapacity, 0) }
+        { }
+
+        // Nothrow
+        mapped_vector& operator=(mapped_vector&& rhs) noexcept
+        {
+            if (this != &rhs)
+            {
+                trim();
+
+                mFile = std::move(rhs.mFile);
+                mSize = std::exchange(rhs.mSize, 0);
+                mCapacity = std::exchange(rhs.mCapacity, 0);
+            }
+
+            return *this;
+        }
+
+        // Nothrow
+        ~mapped_vector() noexcept
+        {
+            trim();
+        }
+
+        // Nothrow
+        size_type size() const noexcept { return mSize; }
+        size_type capacity() const noexcept { return mCapacity; }
+
+        // Strong
+        reference operator[](std::size_t index) { return data()[index]; }
+        const_reference operator[](std::size_t index) const { return data()[index]; }
+
+        // Nothrow
+        pointer data() noexcept { return mFile.data() != nullptr ? reinterpret_cast<T*>(mFile.data() + data_offset) : nullptr; }
+        const_pointer data() const noexcept { return const_cast<mapped_vector&>(*this).data(); }
+
+        // Nothrow
+        bool empty() const noexcept { return mSize == 0; }
+
+        iterator begin() noexcept { return data(); }
+        const_iterator begin() const noexcept { return data(); }
+        const_iterator cbegin() const noexcept { return data(); }
+
+        iterator end() noexcept { return data() + mSize; }
+        const_iterator end() const noexcept { return data() + mSize; }
+        const_iterator cend() const noexcept { return data() + mSize; }
+
+        // Strong
+        void reserve(size_type capacity)
+        {
+            if (capacity <= this->capacity()) { return; }
+            if (capacity > (std::numeric_limits<std::size_t>::max() - data_offset) / sizeof(T)) 
+            { 
+                throw std::length_error{ "vectorx::mapped_vector too large" }; 
+            }
+
+            remap(capacity);
+        }
+
+        // Strong, gives the unused tail of the file back
+        void shrink_to_fit()
+        {
+            remap(mSize);
+        }
+
+        // Throws std::system_error. Blocks until the elements and their count are written back to disk.
+        void sync() const
+        {
+            mFile.sync();
+        }
+
+        // Strong
+        void push_back(const T& value)
+        {
+            emplace_back(value);
+        }
+
+        // Strong
+        void push_back(T&& value)
+        {
+            emplace_back(std::move(value));
+        }
+
+        // Strong
+        template <typename... Args>
+        reference emplace_back(Args&&... args)
+        {
+            if (mSize == capacity())
+            {
+                const T value(std::forward<Args>(args)...); // args may refer to an element
+                grow(mSize + 1);
+
+                T* location{ std::construct_at(end(), value) };
+                set_size(mSize + 1);
+
+                return *location;
+            }
+
+            T* location{ std::construct_at(end(), std::forward<Args>(args)...) };
+            set_size(mSize + 1);
+
+            return *location;
+        }
+
+        // Strong. Requires size() < capacity()
+        void push_back_unchecked(const T& value)
+        {
+            emplace_back_unchecked(value);
+        }
+
+        // Strong. Requires size() < capacity()
+        void push_back_unchecked(T&& value)
+        {
+            emplace_back_unchecked(std::move(value));
+        }
+
+        // Strong. Requires size() < capacity(), never remaps
+        template <typename... Args>
+        reference emplace_back_unchecked(Args&&... args)
+        {
+            T* location{ std::construct_at(end(), std::forward<Args>(args)...) };
+            set_size(mSize + 1);
+
+            return *location;
+        }
+
+        // Nothrow
+        void pop_back() noexcept
+        {
+            set_size(mSize - 1);
+        }
+
+        // Nothrow, keeps the capacity
+        void clear() noexcept
+        {
+            set_size(0);
+        }
+
+        // Strong
+        void resize(std::size_t new_sz)
+        {
+            resize_with(new_sz);
+        }
+
+        // Strong
+        void resize(std::size_t new_sz, const value_type& init_value)
+        {
+            resize_with(new_sz, T(init_value));
+        }
+
+        // Strong. New elements keep whatever the file holds at their position, zeroes for a fresh extension
+        void resize_for_overwrite(std::size_t new_sz)
+        {
+            resize_with(new_sz, detail::default_init);
+        }
+
+        // Strong, may remap the file and move every element
+        void assign(size_type count, const T& value)
+        {
+            const T copy_value(value); // value may refer to an element
+            reserve(count);
+
+            detail::uninitialized_construct_with_args_n(count, data(), copy_value);
+            set_size(count);
+        }
+
+        // Basic, the vector is left empty if an element's conversion throws
+        template <std::input_iterator It>
+        void assign(It first, It last)
+        {
+            assign_range(std::ranges::subrange(std::move(first), std::move(last)));
+        }
+
+        // Strong
+        void assign(std::initializer_list<T> list)
+        {
+            assign_range(list);
+        }
+
+        // Basic, the vector is left empty if an element's conversion throws. rg must not refer to this vector's elements.
+        template <std::ranges::input_range R>
+            requires std::convertible_to<std::ranges::range_reference_t<R>, T>
+        void assign_range(R&& rg)
+        {
+            if constexpr (std::ranges::forward_range<R> || std::ranges::sized_range<R>)
+            {
+                const auto count{ static_cast<size_type>(std::ranges::distance(rg)) };
+                reserve(count);
+
+                set_size(0);
+                detail::uninitialized_copy_n(std::ranges::begin(rg), count, data());
+                set_size(count);
+            }
+            else 
+            {
+                clear();
+                append_range(std::forward<R>(rg));
+            }
+        }
+
+        // Strong
+        template <typename... Args>
+        iterator emplace(const_iterator pos, Args&&... args)
+        {
+            const T value(std::forward<Args>(args)...); // args may refer to an element
+            return insert_with(index_of(pos), 1, [&](T* location) { std::construct_at(location, value); });
+        }
+
+        // Strong
+        iterator insert(const_iterator pos, const T& value)
+        {
+            return emplace(pos, value);
+        }
+
+        // Strong
+        iterator insert(const_iterator pos, size_type n, const T& value)
+        {
+            const T copy_value(value); // value may refer to an element
+            return insert_with(index_of(pos), n, [&](T* location) { detail::uninitialized_construct_with_args_n(n, location, copy_value); });
+        }
+
+        // Strong. [first, last) must not refer to this vector's elements
+        template <std::input_iterator It>
+        iterator insert(const_iterator pos, It first, It last)
+        {
+            return insert_range(pos, std::ranges::subrange(std::move(first), std::move(last)));
+        }
+
+        // Strong
+        iterator insert(const_iterator pos, std::initializer_list<T> list)
+        {
+            return insert_range(pos, list);
+        }
+
+        // Strong, remaps at most once. rg must not refer to this vector's elements.
+        template <std::ranges::input_range R>
+            requires std::convertible_to<std::ranges::range_reference_t<R>, T>
+        iterator insert_range(const_iterator pos, R&& rg)
+        {
+            if constexpr (std::ranges::forward_range<R> || std::ranges::sized_range<R>)
+            {
+                const auto n{ static_cast<std::size_t>(std::ranges::distance(rg)) };
+                return insert_with(index_of(pos), n, [&](T* location) { detail::uninitialized_copy_n(std::ranges::begin(rg), n, location); });
+            }
+            else 
+            {
+                vector<T> tmp{};
+                for (auto&& el : rg)
+                {
+                    tmp.emplace_back(std::forward<decltype(el)>(el));
+                }
+
+                return insert_range(pos, tmp);
+            }
+        }
+
+        // Strong, grows at most once for forward and sized ranges
+        template <std::ranges::input_range R>
+            requires std::convertible_to<std::ranges::range_reference_t<R>, T>
+        void append_range(R&& rg)
+        {
+            if constexpr (std::ranges::forward_range<R> || std::ranges::sized_range<R>)
+            {
+                const auto n{ static_cast<std::size_t>(std::ranges::distance(rg)) };
+                insert_with(mSize, n, [&](T* location) { detail::uninitialized_copy_n(std::ranges::begin(rg), n, location); });
+            }
+            else 
+            {
+                const size_type old_size{ mSize };
+
+                try 
+                {
+                    for (auto&& el : rg)
+                    {
+                        emplace_back(std::forward<decltype(el)>(el));
+                    }
+                }
+                catch (...)
+                {
+                    set_size(old_size);
+                    throw;
+                }
+            }
+        }
+
+        // Nothrow
+        iterator erase(const_iterator pos) noexcept
+        {
+            return erase(pos, pos + 1);
+        }
+
+        // Nothrow
+        iterator erase(const_iterator first, const_iterator last) noexcept
+        {
+            const auto first_idx{ index_of(first) };
+            const auto count{ index_of(last) - first_idx };
+
+            if (count != 0)
+            {
+                detail::relocate_left(data() + first_idx, end(), count);
+                set_size(mSize - count);
+            }
+
+            return data() + first_idx;
+        }
+
+        // Keeps the elements satisfying pred, returns the number of erased elements
+        template <typename Pred>
+        std::size_t retain(Pred pred)
+        {
+            return remove_if([&pred](const T& el) { return !pred(el); });
+        }
+
+        friend bool operator==(const mapped_vector& lhs, const mapped_vector& rhs)
+        {
+            return lhs.mSize == rhs.mSize && detail::equal_n(lhs.data(), rhs.data(), lhs.mSize);
+        }
+
+        friend auto operator<=>(const mapped_vector& lhs, const mapped_vector& rhs)
+            requires std::three_way_comparable<T>
+        {
+            const std::size_t common{ std::min(lhs.mSize, rhs.mSize) };
+
+            if (const auto cmp{ detail::compare_three_way_n(lhs.data(), rhs.data(), common) }; cmp != 0)
+            {
+                return cmp;
+            }
+
+            return std::compare_three_way_result_t<T>{ lhs.mSize <=> rhs.mSize };
+        }
+
+        friend bool operator!=(const mapped_vector& lhs, const mapped_vector& rhs)
+        {
+            return !(lhs == rhs);
+        }
+
+        // Nothrow, each file keeps its own count
+        friend void swap(mapped_vector& lhs, mapped_vector& rhs) noexcept
+        {
+            using std::swap;
+
+            swap(lhs.mFile, rhs.mFile);
+            swap(lhs.mSize, rhs.mSize);
+            swap(lhs.mCapacity, rhs.mCapacity);
+        }
+
+        template <typename U, growth::policy P, typename Pred>
+        friend std::size_t erase_if(mapped_vector<U, P>& vec, Pred pred);
+
+    private:
+        std::size_t index_of(const_iterator pos) const noexcept
+        {
+            return static_cast<std::size_t>(pos - data());
+        }
+
+        // Strong, resizes the file to hold `capacity` elements
+        void remap(size_type capacity)
+        {
+            mFile.resize(data_offset + capacity * sizeof(T));
+            mCapacity = capacity;
+        }
+
+        // Strong
+        void grow(size_type required)
+        {
+            reserve(GrowthPolicy::next_capacity(capacity(), required, sizeof(T)));
+        }
+
+        // Nothrow
+        detail::MappedHeader& header() const noexcept
+        {
+            return *reinterpret_cast<detail::MappedHeader*>(mFile.data());
+        }
+
+        // Nothrow, elements up to `size` must be in place: the count in the file marks them as committed
+        void set_size(size_type size) noexcept
+        {
+            mSize = size;
+            header().count = size;
+        }
+
+        // Throws std::runtime_error
+        void validate() const
+        {
+            if (mFile.size() < data_offset) { throw std::runtime_error{ "vectorx: not a mapped_vector file" }; }
+
+            // A file written with the other byte order has its magic swapped too, so that is checked first
+            if (header().magic == detail::byteswap(detail::MappedHeader::magic_value) || 
+                (header().magic == detail::MappedHeader::magic_value && header().endian != detail::MappedHeader::endian_tag))
+            {
+                throw std::runtime_error{ "vectorx: mapped_vector file has a different byte order" };
+            }
+
+            if (header().magic != detail::MappedHeader::magic_value) { throw std::runtime_error{ "vectorx: not a mapped_vector file" }; }
+
+            if (header().version != detail::MappedHeader::current_version)
+            {
+                throw std::runtime_error{ "vectorx: unsupported mapped_vector file version" };
+            }
+
+            if (header().value_size != sizeof(T) || header().value_align != alignof(T))
+            {
+                throw std::runtime_error{ "vectorx: mapped_vector element type mismatch" };
+            }
+
+            if (header().count > capacity()) { throw std::runtime_error{ "vectorx: truncated mapped_vector file" }; }
+        }
+
+        // Nothrow, gives the tail past size() back to the file system
+        void trim() noexcept
+        {
+            if (mFile.data() == nullptr) { return; } // moved from
+
+            try
+            {
+                shrink_to_fit();
+            }
+            catch (...) {} // the file keeps its length, the header still tells elements from spare capacity
+        }
+
+        // Strong
+        template <typename... Args>
+        void resize_with(std::size_t new_sz, const Args&... args)
+        {
+            if (new_sz > mSize)
+            {
+                if (new_sz > capacity()) { grow(new_sz); }
+                detail::uninitialized_construct_with_args_n(new_sz - mSize, end(), args...);
+            }
+
+            set_size(new_sz);
+        }
+
+        // Strong, `construct(location)` builds `count` elements at location or leaves it untouched on throw
+        template <typename Construct>
+        iterator insert_with(std::size_t pos_idx, std::size_t count, Construct&& construct)
+        {
+            if (count == 0) { return data() + pos_idx; }
+            if (mSize + count > capacity()) { grow(mSize + count); }
+
+            detail::relocate_right(data() + pos_idx, end(), count);
+
+            try
+            {
+                construct(data() + pos_idx);
+            }
+            catch (...)
+            {
+                detail::relocate_left(data() + pos_idx, end() + count, count);
+                throw;
+            }
+
+            set_size(mSize + count);
+            return data() + pos_idx;
+        }
+
+        template <typename Pred>
+        std::size_t remove_if(Pred&& pred)
+        {
+            const auto old_sz{ mSize };
+            auto size{ mSize };
+
+            try
+            {
+                detail::relocate_remove_if(data(), size, pred);
+            }
+            catch (...)
+            {
+                set_size(size);
+                throw;
+            }
+
+            set_size(size);
+            return old_sz - mSize;
+        }
+
+    private:
+        detail::MappedFile mFile;
+        size_type mSize{};
+        size_type mCapacity{}; // follows mFile.size(), kept here so growth checks don't divide
+    };
+
+    // Returns the number of erased elements
+    template <typename T, growth::policy GrowthPolicy, typename Pred>
+    std::size_t erase_if(mapped_vector<T, GrowthPolicy>& vec, Pred pred)
+    {
+        return vec.remove_if(pred);
+    }
+
+    // Returns the number of erased elements
+    template <typename T, growth::policy GrowthPolicy, typename U>
+    std::size_t erase(mapped_vector<T, GrowthPolicy>& vec, const U& value)
+    {
+        const U copy_value(value); // value may refer to an element
+        return erase_if(vec, [&copy_value](const T& el) { return el == copy_value; });
+    }
+
+} // namespace vectorx
@@ -0,0 +1,473 @@
+// MIT License
+// 
+// Copyright (c) 2025 Mr. Myxa
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#pragma once
+
+#include <bit>
+#include <span>
+
+#include "vectorx.hpp"
+
+namespace vectorx
+{
+    namespace detail
+    {
+        // Segment k holds FirstSegment << k elements, so index i lives in segment bit_width(i + FirstSegment) - 1 - log2(FirstSegment)
+        template <std::size_t FirstSegment>
+            requires (std::has_single_bit(FirstSegment))
+        struct SegmentLayout
+        {
+            static constexpr std::size_t first_shift{ static_cast<std::size_t>(std::countr_zero(FirstSegment)) };
+            static constexpr std::size_t max_segments{ std::numeric_limits<std::size_t>::digits - first_shift };
+
+            static constexpr std::size_t segment_capacity(std::size_t segment) noexcept { return FirstSegment << segment; }
+
+            // Elements held by the segments before `segment`
+            static constexpr std::size_t segment_offset(std::size_t segment) noexcept { return FirstSegment * ((std::size_t{ 1 } << segment) - 1); }
+
+            static constexpr std::size_t segment_of(std::size_t index) noexcept 
+            { 
+                return static_cast<std::size_t>(std::bit_width(index + FirstSegment)) - 1 - first_shift; 
+            }
+        };
+
+        // Walks one segment with plain pointer increments and only recomputes its position at segment boundaries
+        template <typename T, std::size_t FirstSegment>
+        class SegmentedIterator
+        {
+        public:
+            using iterator_concept = std::random_access_iterator_tag;
+            using iterator_category = std::random_access_iterator_tag;
+            using difference_type = std::ptrdiff_t;
+            using value_type = std::remove_cv_t<T>;
+            using pointer = T*;
+            using reference = T&;
+
+            using layout = SegmentLayout<FirstSegment>;
+            using segments_t = value_type* const*;
+
+        public:
+            constexpr SegmentedIterator() noexcept = default;
+
+            constexpr SegmentedIterator(segments_t segments, std::size_t index) noexcept
+                : mSegments{ segments }
+                , mIndex{ index }
+            { 
+                seek();
+            }
+
+            template <typename U>
+                requires std::is_const_v<T> && std::same_as<U, std::remove_const_t<T>>
+            constexpr SegmentedIterator(SegmentedIterator<U, FirstSegment> rhs) noexcept
+                : SegmentedIterator{ rhs.mSegments, rhs.mIndex }
+            { }
+
+            constexpr pointer operator->() const noexcept { return mPtr; }
+            constexpr reference operator*() const noexcept { return *mPtr; }
+            constexpr reference operator[](difference_type index) const noexcept { return *(*this + index); }
+
+            constexpr SegmentedIterator& operator++() noexcept
+            {
+                ++mIndex;
+                if (++mPtr == mSegmentEnd) { seek(); }
+
+                return *this;
+            }
+
+            constexpr SegmentedIterator operator++(int) noexcept
+            {
+                auto cp{ *this };
+                ++(*this);
+
+                return cp;
+            }
+
+            constexpr SegmentedIterator& operator--() noexcept
+            {
+                return *this -= 1;
+            }
+
+            constexpr SegmentedIterator operator--(int) noexcept
+            {
+                auto cp{ *this };
+                --(*this);
+
+                return cp;
+            }
+
+            constexpr SegmentedIterator& operator+=(difference_type offset) noexcept
+            {
+                mIndex += static_cast<std::size_t>(offset);
+                seek();
+
+                return *this;
+            }
+
+            constexpr SegmentedIterator& operator-=(difference_type offset) noexcept
+            {
+                return *this += -offset;
+            }
+
+            friend constexpr bool operator==(const SegmentedIterator& lhs, const SegmentedIterator& rhs) noexcept { return lhs.mIndex == rhs.mIndex; }
+            friend constexpr std::strong_ordering operator<=>(const SegmentedIterator& lhs, const SegmentedIterator& rhs) noexcept { return lhs.mIndex <=> rhs.mIndex; }
+
+            friend constexpr SegmentedIterator operator+(SegmentedIterator it, difference_type n) noexcept { it += n; return it; }
+            friend constexpr SegmentedIterator operator-(SegmentedIterator it, difference_type n) noexcept { it -= n; return it; }
+            friend constexpr SegmentedIterator operator+(difference_type n, SegmentedIterator it) noexcept { return it + n; }
+            
+            friend constexpr difference_type operator-(const SegmentedIterator& lhs, const SegmentedIterator& rhs) noexcept 
+            { 
+                return static_cast<difference_type>(lhs.mIndex - rhs.mIndex); 
+            }
+
+        private:
+            template <typename U, std::size_t F>
+            friend class SegmentedIterator;
+
+            // Segments past the last allocated one are null, which only the end iterator can point into
+            constexpr void seek() noexcept
+            {
+                const auto segment{ layout::segment_of(mIndex) };
+                value_type* first{ mSegments != nullptr ? mSegments[segment] : nullptr };
+
+                mPtr = first != nullptr ? first + (mIndex - layout::segment_offset(segment)) : nullptr;
+                mSegmentEnd = first != nullptr ? first + layout::segment_capacity(segment) : nullptr;
+            }
+
+        private:
+            segments_t mSegments{};
+            std::size_t mIndex{};
+            pointer mPtr{};
+            pointer mSegmentEnd{};
+        };
+
+        template <typename T>
+        inline constexpr std::size_t default_first_segment{ std::bit_ceil(std::max<std::size_t>(1024 / sizeof(T), 8)) };
+    } // namespace detail
+
+    // Grows by appending segments of doubling size: elements never move, so references stay valid until
+    // the element is removed, and push_back never copies the existing contents. The segment table lives
+    // on the heap and travels with the elements, so iterators also survive moves and swaps.
+    template <typename T, 
+              std::size_t FirstSegment = detail::default_first_segment<T>, 
+              typename Alloc = std::allocator<T>>
+    class segmented_vector
+    {
+        using layout = detail::SegmentLayout<FirstSegment>;
+
+    public:
+        using value_type = T;
+        using allocator_type = Alloc;
+        using size_type = std::size_t;
+        using difference_type = std::ptrdiff_t;
+        using reference = value_type&;
+        using const_reference = const value_type&;
+        using iterator = detail::SegmentedIterator<T, FirstSegment>;
+        using const_iterator = detail::SegmentedIterator<const T, FirstSegment>;
+
+        using alloc_traits = std::allocator_traits<Alloc>;
+
+    private:
+        using table_alloc = typename alloc_traits::template rebind_alloc<T*>;
+        using table_traits = std::allocator_traits<table_alloc>;
+
+    public:
+        // Nothrow
+        segmented_vector() = default;
+
+        // Nothrow if alloc nothrow
+        explicit segmented_vector(const Alloc& alloc)
+            : mAlloc{ alloc }
+        { }
+
+        // Strong
+        segmented_vector(std::initializer_list<T> list, const Alloc& alloc = Alloc{})
+            : segmented_vector(alloc)
+        {
+            reserve(std::size(list));
+
+            for (const auto& el : list)
+            {
+                emplace_back(el);
+            }
+        }
+
+        // Strong
+        segmented_vector(const segmented_vector& rhs)
+            : segmented_vector(alloc_traits::select_on_container_copy_construction(rhs.mAlloc))
+        {
+            reserve(rhs.mSize);
+            rhs.for_each_segment([this](std::span<const T> segment)
+            {
+                for (const auto& el : segment) { emplace_back(el); }
+            });
+        }
+
+        // Nothrow
+        segmented_vector(segmented_vector&& rhs) noexcept
+            : mAlloc{ std::move(rhs.mAlloc) }
+        {
+            take(rhs);
+        }
+
+        // Strong
+        segmented_vector& operator=(const segmented_vector& rhs)
+        {
+            if (this != &rhs)
+            {
+                segmented_vector copy(rhs);
+                swap(*this, copy);
+            }
+
+            return *this;
+        }
+
+        // Nothrow if the allocator propagates or is always equal, strong otherwise
+        segmented_vector& operator=(segmented_vector&& rhs) noexcept(alloc_traits::propagate_on_container_move_assignment::value || 
+                                                                     alloc_traits::is_always_equal::value)
+        {
+            if (this != &rhs)
+            {
+                if constexpr (!alloc_traits::propagate_on_container_move_assignment::value && 
+                              !alloc_traits::is_always_equal::value)
+                {
+                    if (mAlloc != rhs.mAlloc) // segments of an unequal allocator can't be adopted
+                    {
+                        segmented_vector copy(mAlloc);
+                        copy.reserve(rhs.mSize);
+
+                        for (auto& el : rhs) { copy.emplace_back(std::move(el)); }
+                        
+                        swap(*this, copy);
+                        rhs.clear();
+
+                        return *this;
+                    }
+                }
+
+                segmented_vector released(std::move(*this));
+                
+                if constexpr (alloc_traits::propagate_on_container_move_assignment::value) { mAlloc = std::move(rhs.mAlloc); }
+                take(rhs);
+            }
+
+            return *this;
+        }
+
+        // Nothrow
+        ~segmented_vector() noexcept
+        {
+            clear();
+
+            for (std::size_t segment{}; segment < mSegmentCount; ++segment)
+            {
+                alloc_traits::deallocate(mAlloc, mSegments[segment], layout::segment_capacity(segment));
+            }
+
+            if (mSegments != nullptr)
+            {
+                table_alloc alloc(mAlloc);
+                table_traits::deallocate(alloc, mSegments, layout::max_segments);
+            }
+        }
+
+        // Nothrow
+        allocator_type get_allocator() const noexcept { return mAlloc; }
+
+        // Nothrow
+        size_type size() const noexcept { return mSize; }
+        size_type capacity() const noexcept { return layout::segment_offset(mSegmentCount); }
+        bool empty() const noexcept { return mSize == 0; }
+
+        // Strong
+        reference operator[](std::size_t index) { return *locate(index); }
+        const_reference operator[](std::size_t index) const { return *locate(index); }
+
+        iterator begin() noexcept { return iterator{ mSegments, 0 }; }
+        const_iterator begin() const noexcept { return const_iterator{ mSegments, 0 }; }
+        const_iterator cbegin() const noexcept { return begin(); }
+
+        iterator end() noexcept { return iterator{ mSegments, mSize }; }
+        const_iterator end() const noexcept { return const_iterator{ mSegments, mSize }; }
+        const_iterator cend() const noexcept { return end(); }
+
+        // Nothrow. Segments that hold elements, each one is contiguous
+        size_type segment_count() const noexcept { return mSize == 0 ? 0 : layout::segment_of(mSize - 1) + 1; }
+
+        // Nothrow. The live elements of segment `index`, for loops that should vectorize
+        std::span<T> segment(size_type index) noexcept { return { mSegments[index], segment_size(index) }; }
+        std::span<const T> segment(size_type index) const noexcept { return { mSegments[index], segment_size(index) }; }
+
+        // Calls f with a span per segment
+        template <typename F>
+        void for_each_segment(F&& f)
+        {
+            for (size_type index{}, count{ segment_count() }; index < count; ++index) { f(segment(index)); }
+        }
+
+        template <typename F>
+        void for_each_segment(F&& f) const
+        {
+            for (size_type index{}, count{ segment_count() }; index < count; ++index) { f(segment(index)); }
+        }
+
+        // Strong, allocates the segments needed for `capacity` elements
+        void reserve(size_type capacity)
+        {
+            while (this->capacity() < capacity) { add_segment(); }
+        }
+
+        // Strong
+        void push_back(const T& value)
+        {
+            emplace_back(value);
+        }
+
+        // Strong
+        void push_back(T&& value)
+        {
+            emplace_back(std::move(value));
+        }
+
+        // Strong, existing elements stay where they are so args may refer to them
+        template <typename... Args>
+        reference emplace_back(Args&&... args)
+        {
+            if (mSize == capacity()) { add_segment(); }
+
+            T* location{ std::construct_at(locate(mSize), std::forward<Args>(args)...) };
+            ++mSize;
+
+            return *location;
+        }
+
+        // Nothrow
+        void pop_back() noexcept
+        {
+            std::destroy_at(locate(--mSize));
+        }
+
+        // Nothrow, keeps the segments
+        void clear() noexcept
+        {
+            for_each_segment([](std::span<T> segment) { std::destroy(segment.begin(), segment.end()); });
+            mSize = 0;
+        }
+
+        // Strong
+        void resize(size_type new_sz)
+        {
+            resize_with(new_sz);
+        }
+
+        // Strong
+        void resize(size_type new_sz, const value_type& init_value)
+        {
+            resize_with(new_sz, init_value);
+        }
+
+        friend bool operator==(const segmented_vector& lhs, const segmented_vector& rhs)
+        {
+            return lhs.mSize == rhs.mSize && std::equal(lhs.begin(), lhs.end(), rhs.begin());
+        }
+
+        friend bool operator!=(const segmented_vector& lhs, const segmented_vector& rhs)
+        {
+            return !(lhs == rhs);
+        }
+
+        // Nothrow
+        friend void swap(segmented_vector& lhs, segmented_vector& rhs) noexcept
+        {
+            using std::swap;
+
+            if constexpr (alloc_traits::propagate_on_container_swap::value) { swap(lhs.mAlloc, rhs.mAlloc); }
+
+            swap(lhs.mSegments, rhs.mSegments);
+            swap(lhs.mSegmentCount, rhs.mSegmentCount);
+            swap(lhs.mSize, rhs.mSize);
+        }
+
+    private:
+        T* locate(size_type index) const noexcept
+        {
+            const auto segment{ layout::segment_of(index) };
+            return mSegments[segment] + (index - layout::segment_offset(segment));
+        }
+
+        size_type segment_size(size_type index) const noexcept
+        {
+            return std::min(mSize - layout::segment_offset(index), layout::segment_capacity(index));
+        }
+
+        // Strong, the table is allocated with the first segment
+        void add_segment()
+        {
+            if (mSegmentCount == layout::max_segments) { throw std::length_error{ "vectorx::segmented_vector too large" }; }
+
+            if (mSegments == nullptr)
+            {
+                table_alloc alloc(mAlloc);
+                mSegments = table_traits::allocate(alloc, layout::max_segments);
+                std::uninitialized_fill_n(mSegments, layout::max_segments, nullptr);
+            }
+
+            mSegments[mSegmentCount] = alloc_traits::allocate(mAlloc, layout::segment_capacity(mSegmentCount));
+            ++mSegmentCount;
+        }
+
+        // Nothrow, adopts rhs's segment table and leaves it empty
+        void take(segmented_vector& rhs) noexcept
+        {
+            mSegments = std::exchange(rhs.mSegments, nullptr);
+            mSegmentCount = std::exchange(rhs.mSegmentCount, 0);
+            mSize = std::exchange(rhs.mSize, 0);
+        }
+
+        // Strong
+        template <typename... Args>
+        void resize_with(size_type new_sz, const Args&... args)
+        {
+            const size_type old_sz{ mSize };
+
+            try
+            {
+                while (mSize > new_sz) { pop_back(); }
+                while (mSize < new_sz) { emplace_back(args...); }
+            }
+            catch (...)
+            {
+                while (mSize > old_sz) { pop_back(); }
+                throw;
+            }
+        }
+
+    private:
+        [[no_unique_address]] Alloc mAlloc{};
+
+        T** mSegments{};
+        size_type mSegmentCount{};
+        size_type mSize{};
+    };
+
+} // namespace vectorx
@@ -0,0 +1,181 @@
+// MIT License
+// 
+// Copyright (c) 2025 Mr. Myxa
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#pragma once
+
+#include "vectorx.hpp"
+
+namespace vectorx
+{
+    namespace detail
+    {
+        // Keeps up to N elements inside the object and spills to a heap Buffer past that.
+        // Owns no elements itself: moves and swaps take the live element counts from the vector.
+        template <typename T, std::size_t N, typename Alloc = std::allocator<T>>
+            requires (N > 0)
+        class SmallBuffer
+        {
+        public:
+            using alloc_traits = std::allocator_traits<Alloc>;
+            using heap_t = Buffer<T, Alloc>;
+
+            static constexpr bool is_reallocatable{ false };
+            static constexpr std::size_t inline_capacity{ N };
+
+        public:
+            SmallBuffer() noexcept
+                : mHeap{}
+                , mData{ inline_data() }
+            { }
+
+            SmallBuffer(const Alloc& alloc) 
+                : mHeap{ alloc }
+                , mData{ inline_data() }
+            { }
+
+            explicit SmallBuffer(std::size_t capacity, const Alloc& alloc = Alloc{}) 
+                : mHeap{ capacity > N ? heap_t{ capacity, alloc } : heap_t{ alloc } }
+                , mData{ is_inline() ? inline_data() : mHeap.data() }
+            { }
+
+            SmallBuffer(const SmallBuffer& rhs)
+                : mHeap{ rhs.is_inline() ? heap_t{ alloc_traits::select_on_container_copy_construction(rhs.get_allocator()) } : heap_t{ rhs.mHeap } }
+                , mData{ is_inline() ? inline_data() : mHeap.data() }
+            { }
+
+            // Nothrow, relocates the first `size` elements of an inline rhs
+            SmallBuffer(SmallBuffer&& rhs, std::size_t size) noexcept
+                : mHeap{ std::move(rhs.mHeap) }
+                , mData{ is_inline() ? inline_data() : mHeap.data() }
+            {
+                if (is_inline())
+                {
+                    uninitialized_relocate_n(rhs.inline_data(), size, inline_data());
+                }
+
+                rhs.mData = rhs.inline_data();
+            }
+
+            SmallBuffer& operator=(const SmallBuffer&) = delete;
+
+            // Nothrow, *this must hold no live elements
+            void assign(SmallBuffer&& rhs, std::size_t size) noexcept
+            {
+                const bool rhs_inline{ rhs.is_inline() };
+                mHeap = std::move(rhs.mHeap);
+
+                if (rhs_inline)
+                {
+                    uninitialized_relocate_n(rhs.inline_data(), size, inline_data());
+                }
+
+                mData = is_inline() ? inline_data() : mHeap.data();
+                rhs.mData = rhs.inline_data();
+            }
+
+            T* data(std::size_t offset = 0) noexcept
+            {
+                return mData + offset;
+            }
+
+            const T* data(std::size_t offset = 0) const noexcept
+            {
+                return mData + offset;
+            }
+
+            std::size_t capacity() const noexcept
+            {
+                return is_inline() ? N : mHeap.capacity();
+            }
+
+            bool is_inline() const noexcept
+            {
+                return mHeap.capacity() == 0;
+            }
+
+            Alloc& get_allocator()
+            {
+                return mHeap.get_allocator();
+            }
+
+            const Alloc& get_allocator() const
+            {
+                return mHeap.get_allocator();
+            }
+
+            bool try_expand(std::size_t capacity) noexcept
+            {
+                return capacity <= this->capacity();
+            }
+
+            void release_unused(std::size_t used) noexcept
+            {
+                mHeap.release_unused(used);
+            }
+
+            // Nothrow
+            static void swap(SmallBuffer& lhs, std::size_t lhs_size, SmallBuffer& rhs, std::size_t rhs_size) noexcept
+            {
+                if (lhs.is_inline() && rhs.is_inline())
+                {
+                    alignas(T) std::byte tmp[N * sizeof(T)];
+                    T* tmp_data{ reinterpret_cast<T*>(tmp) };
+
+                    uninitialized_relocate_n(lhs.inline_data(), lhs_size, tmp_data);
+                    uninitialized_relocate_n(rhs.inline_data(), rhs_size, lhs.inline_data());
+                    uninitialized_relocate_n(tmp_data, lhs_size, rhs.inline_data());
+                }
+                else if (lhs.is_inline())
+                {
+                    uninitialized_relocate_n(lhs.inline_data(), lhs_size, rhs.inline_data());
+                }
+                else if (rhs.is_inline())
+                {
+                    uninitialized_relocate_n(rhs.inline_data(), rhs_size, lhs.inline_data());
+                }
+
+                using std::swap;
+                swap(lhs.mHeap, rhs.mHeap);
+
+                lhs.mData = lhs.is_inline() ? lhs.inline_data() : lhs.mHeap.data();
+                rhs.mData = rhs.is_inline() ? rhs.inline_data() : rhs.mHeap.data();
+            }
+
+        private:
+            T* inline_data() noexcept { return reinterpret_cast<T*>(mInline); }
+
+        private:
+            heap_t mHeap;
+            T* mData;
+
+            alignas(T) std::byte mInline[N * sizeof(T)];
+        };
+    } // namespace detail
+
+    template <typename T, 
+              std::size_t N, 
+              typename Alloc = std::allocator<T>, 
+              growth::policy GrowthPolicy = growth::doubling>
+    using small_vector = vector<T, Alloc, GrowthPolicy, detail::SmallBuffer<T, N, Alloc>>;
+
+} // namespace vectorx
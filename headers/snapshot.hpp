@@ -0,0 +1,321 @@
+// MIT License
+// 
+// Copyright (c) 2025 Mr. Myxa
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#pragma once
+
+#include <cerrno>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <system_error>
+
+#include "vectorx.hpp"
+
+#if defined(__linux__)
+#include <fcntl.h>
+#include <sys/stat.h>
+#endif
+
+namespace vectorx
+{
+    // Missing, truncated, corrupted or mismatching snapshot
+    class snapshot_error : public std::runtime_error
+    {
+    public:
+        using std::runtime_error::runtime_error;
+    };
+
+    namespace detail
+    {
+        // On-disk layout: this header, padding up to data_offset, then count raw elements
+        struct SnapshotHeader
+        {
+            static constexpr std::uint64_t magic_value{ 0x3130'5853'5254'4356 }; // "VCTRSX01" little endian
+            static constexpr std::uint32_t current_version{ 1 };
+            static constexpr std::uint32_t endian_tag{ 0x0102'0304 };
+
+            std::uint64_t magic{ magic_value };
+            std::uint32_t version{ current_version };
+            std::uint32_t endian{ endian_tag };
+            std::uint32_t value_size{};
+            std::uint32_t value_align{};
+            std::uint64_t data_offset{};
+            std::uint64_t count{};
+            std::uint64_t checksum{};
+            std::byte reserved[16]{};
+        };
+
+        static_assert(sizeof(SnapshotHeader) == 64 && std::is_trivially_copyable_v<SnapshotHeader>);
+
+        // Four independent multiply-xor lanes over 8 byte words, fast enough to keep up with sequential reads
+        inline std::uint64_t checksum(const std::byte* data, std::size_t bytes) noexcept
+        {
+            constexpr std::uint64_t prime{ 0x9E37'79B9'7F4A'7C15 };
+            std::uint64_t lanes[4]{ 1, 2, 3, 4 };
+
+            std::size_t i{};
+            for (; i + 32 <= bytes; i += 32)
+            {
+                for (std::size_t lane{}; lane < 4; ++lane)
+                {
+                    std::uint64_t word{};
+                    std::memcpy(&word, data + i + lane * 8, 8);
+
+                    lanes[lane] = (lanes[lane] ^ word) * prime;
+                    lanes[lane] ^= lanes[lane] >> 29;
+                }
+            }
+
+            std::uint64_t hash{ bytes * prime };
+            for (std::uint64_t lane : lanes)
+            {
+                hash = (hash ^ lane) * prime;
+            }
+
+            for (; i < bytes; ++i)
+            {
+                hash = (hash ^ static_cast<std::uint64_t>(data[i])) * prime;
+            }
+
+            return hash ^ (hash >> 32);
+        }
+
+        template <typename T>
+        constexpr std::uint64_t snapshot_data_offset() noexcept
+        {
+            return std::max<std::uint64_t>(sizeof(SnapshotHeader), alignof(T));
+        }
+
+        // Throws snapshot_error unless the header describes count elements of T stored in a file of file_size bytes
+        template <typename T>
+        void validate(const SnapshotHeader& header, std::uint64_t file_size)
+        {
+            // A snapshot written with the other byte order has its magic swapped too, so that is checked first
+            if (header.magic == byteswap(SnapshotHeader::magic_value) || 
+                (header.magic == SnapshotHeader::magic_value && header.endian != SnapshotHeader::endian_tag))
+            {
+                throw snapshot_error{ "vectorx: snapshot has a different byte order" };
+            }
+
+            if (header.magic != SnapshotHeader::magic_value) { throw snapshot_error{ "vectorx: not a snapshot" }; }
+            if (header.version != SnapshotHeader::current_version) { throw snapshot_error{ "vectorx: unsupported snapshot version" }; }
+
+            if (header.value_size != sizeof(T) || header.value_align != alignof(T)) 
+            { 
+                throw snapshot_error{ "vectorx: snapshot element type mismatch" }; 
+            }
+
+            if (header.data_offset % alignof(T) != 0 || header.data_offset < sizeof(SnapshotHeader) || 
+                header.count > (file_size - std::min(file_size, header.data_offset)) / sizeof(T))
+            {
+                throw snapshot_error{ "vectorx: truncated snapshot" };
+            }
+        }
+    } // namespace detail
+
+    // Throws snapshot_error. Writes the elements of rg behind a header carrying their layout, count and checksum.
+    template <std::ranges::contiguous_range R>
+        requires std::ranges::sized_range<R> && std::is_trivially_copyable_v<std::ranges::range_value_t<R>>
+    void save(const R& rg, const std::filesystem::path& path)
+    {
+        using T = std::ranges::range_value_t<R>;
+
+        const auto* bytes{ reinterpret_cast<const std::byte*>(std::ranges::data(rg)) };
+        const auto size{ static_cast<std::size_t>(std::ranges::size(rg)) * sizeof(T) };
+
+        detail::SnapshotHeader header{};
+        header.value_size = sizeof(T);
+        header.value_align = alignof(T);
+        header.data_offset = detail::snapshot_data_offset<T>();
+        header.count = std::ranges::size(rg);
+        header.checksum = detail::checksum(bytes, size);
+
+        std::ofstream out{ path, std::ios::binary | std::ios::trunc };
+
+        out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        out.seekp(static_cast<std::streamoff>(header.data_offset)); // padding reads back as zeroes
+        out.write(reinterpret_cast<const char*>(bytes), static_cast<std::streamsize>(size));
+        out.close();
+
+        if (!out) { throw snapshot_error{ "vectorx: can't write snapshot" }; }
+    }
+
+    // Throws snapshot_error. Reads the elements in one pass into an exactly sized vector and checks the checksum.
+    template <typename T, typename Alloc = std::allocator<T>>
+        requires std::is_trivially_copyable_v<T>
+    vector<T, Alloc> load(const std::filesystem::path& path, const Alloc& alloc = Alloc{})
+    {
+        std::ifstream in{ path, std::ios::binary | std::ios::ate };
+        if (!in) { throw snapshot_error{ "vectorx: can't open snapshot" }; }
+
+        const auto file_size{ static_cast<std::uint64_t>(in.tellg()) };
+        if (file_size < sizeof(detail::SnapshotHeader)) { throw snapshot_error{ "vectorx: truncated snapshot" }; }
+
+        detail::SnapshotHeader header{};
+        in.seekg(0);
+        in.read(reinterpret_cast<char*>(&header), sizeof(header));
+        detail::validate<T>(header, file_size);
+
+        vector<T, Alloc> vec(static_cast<std::size_t>(header.count), alloc);
+        vec.resize_for_overwrite(static_cast<std::size_t>(header.count));
+
+        const auto size{ static_cast<std::size_t>(header.count) * sizeof(T) };
+        in.seekg(static_cast<std::streamoff>(header.data_offset));
+        in.read(reinterpret_cast<char*>(vec.data()), static_cast<std::streamsize>(size));
+
+        if (!in) { throw snapshot_error{ "vectorx: can't read snapshot" }; }
+        if (detail::checksum(reinterpret_cast<const std::byte*>(vec.data()), size) != header.checksum) 
+        { 
+            throw snapshot_error{ "vectorx: snapshot checksum mismatch" }; 
+        }
+
+        return vec;
+    }
+
+    // Read-only, zero-copy window over a snapshot file. Pages are faulted in on first touch,
+    // so only the header is checked up front, verify() checks the payload.
+    template <typename T>
+        requires std::is_trivially_copyable_v<T>
+    class view
+    {
+    public:
+        static_assert(detail::pages::is_supported, "snapshot views need mmap");
+
+        using value_type = T;
+        using size_type = std::size_t;
+        using difference_type = std::ptrdiff_t;
+        using const_reference = const value_type&;
+        using const_pointer = const T*;
+        using const_iterator = const T*;
+        using iterator = const_iterator;
+
+    public:
+        // Throws snapshot_error or std::system_error
+        explicit view(const std::filesystem::path& path)
+        {
+#if defined(__linux__)
+            const int fd{ ::open(path.c_str(), O_RDONLY | O_CLOEXEC) };
+            if (fd == -1) { throw std::system_error{ errno, std::generic_category(), "vectorx: can't open snapshot" }; }
+
+            struct stat st{};
+            if (::fstat(fd, &st) == -1 || static_cast<std::size_t>(st.st_size) < sizeof(detail::SnapshotHeader))
+            {
+                ::close(fd);
+                throw snapshot_error{ "vectorx: truncated snapshot" };
+            }
+
+            mLength = static_cast<std::size_t>(st.st_size);
+            void* ptr{ ::mmap(nullptr, mLength, PROT_READ, MAP_PRIVATE, fd, 0) };
+            const int err{ errno }; // close may overwrite it
+            ::close(fd); // the mapping keeps the file alive
+
+            if (ptr == MAP_FAILED) { throw std::system_error{ err, std::generic_category(), "vectorx: can't map snapshot" }; }
+            mMapping = static_cast<const std::byte*>(ptr);
+
+            try
+            {
+                detail::validate<T>(header(), mLength);
+            }
+            catch (...)
+            {
+                ::munmap(const_cast<std::byte*>(mMapping), mLength);
+                throw;
+            }
+#endif
+        }
+
+        view(const view&) = delete;
+        view& operator=(const view&) = delete;
+
+        // Nothrow
+        view(view&& rhs) noexcept
+            : mMapping{ std::exchange(rhs.mMapping, nullptr) }
+            , mLength{ std::exchange(rhs.mLength, 0) }
+        { }
+
+        // Nothrow
+        view& operator=(view&& rhs) noexcept
+        {
+            if (this != &rhs)
+            {
+                unmap();
+
+                mMapping = std::exchange(rhs.mMapping, nullptr);
+                mLength = std::exchange(rhs.mLength, 0);
+            }
+
+            return *this;
+        }
+
+        // Nothrow
+        ~view() noexcept
+        {
+            unmap();
+        }
+
+        // Nothrow
+        size_type size() const noexcept { return mMapping != nullptr ? static_cast<size_type>(header().count) : 0; }
+        bool empty() const noexcept { return size() == 0; }
+
+        // Nothrow
+        const_pointer data() const noexcept 
+        { 
+            return mMapping != nullptr ? reinterpret_cast<const T*>(mMapping + header().data_offset) : nullptr; 
+        }
+
+        const_reference operator[](std::size_t index) const { return data()[index]; }
+
+        const_iterator begin() const noexcept { return data(); }
+        const_iterator cbegin() const noexcept { return data(); }
+
+        const_iterator end() const noexcept { return data() + size(); }
+        const_iterator cend() const noexcept { return data() + size(); }
+
+        // Reads the whole payload, true if it matches the checksum written by save()
+        bool verify() const noexcept
+        {
+            return mMapping == nullptr || 
+                   detail::checksum(reinterpret_cast<const std::byte*>(data()), size() * sizeof(T)) == header().checksum;
+        }
+
+    private:
+        const detail::SnapshotHeader& header() const noexcept
+        {
+            return *reinterpret_cast<const detail::SnapshotHeader*>(mMapping);
+        }
+
+        void unmap() noexcept
+        {
+#if defined(__linux__)
+            if (mMapping != nullptr) { ::munmap(const_cast<std::byte*>(mMapping), mLength); }
+#endif
+            mMapping = nullptr;
+        }
+
+    private:
+        const std::byte* mMapping{};
+        std::size_t mLength{};
+    };
+
+} // namespace vectorx
@@ -0,0 +1,442 @@
+// MIT License
+// 
+// Copyright (c) 2025 Mr. Myxa
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#pragma once
+
+#include <cstdint>
+#include <cstdlib>
+#include <stdexcept>
+
+#include "vectorx.hpp"
+
+namespace vectorx
+{
+    namespace overflow
+    {
+        // Every policy is called when an operation would exceed the fixed capacity
+        template <typename P>
+        concept policy = requires { P::on_overflow(); };
+
+        struct throws
+        {
+            [[noreturn]] static void on_overflow() { throw std::length_error{ "vectorx::static_vector capacity exceeded" }; }
+        };
+
+        struct terminates
+        {
+            [[noreturn]] static void on_overflow() noexcept { std::abort(); }
+        };
+    } // namespace overflow
+
+    namespace detail
+    {
+        template <std::size_t N>
+        using compact_size_t = std::conditional_t<N <= std::numeric_limits<std::uint8_t>::max(), std::uint8_t,
+                               std::conditional_t<N <= std::numeric_limits<std::uint16_t>::max(), std::uint16_t,
+                               std::conditional_t<N <= std::numeric_limits<std::uint32_t>::max(), std::uint32_t, std::size_t>>>;
+    } // namespace detail
+
+    // Fixed capacity vector with inline storage, never allocates
+    template <typename T, std::size_t N, overflow::policy OverflowPolicy = overflow::throws>
+        requires std::is_nothrow_move_assignable_v<T> &&
+                 std::is_nothrow_move_constructible_v<T> &&
+                 (N > 0)
+    class static_vector
+    {
+    public:
+        using value_type = T;
+        using size_type = std::size_t;
+        using difference_type = std::ptrdiff_t;
+        using reference = value_type&;
+        using const_reference = const value_type&;
+        using pointer = T*;
+        using const_pointer = const T*;
+        using iterator = T*;
+        using const_iterator = const T*;
+
+    public:
+        // Nothrow
+        static_vector() noexcept = default;
+
+        // Strong
+        static_vector(std::initializer_list<T> list)
+        {
+            check_capacity(std::size(list));
+
+            std::uninitialized_copy_n(std::begin(list), std::size(list), data());
+            mSize = static_cast<stored_size_t>(std::size(list));
+        }
+
+        static_vector(const static_vector&) requires std::is_trivially_copyable_v<T> = default;
+
+        // Strong
+        static_vector(const static_vector& rhs)
+        {
+            std::uninitialized_copy_n(rhs.data(), rhs.mSize, data());
+            mSize = rhs.mSize;
+        }
+
+        static_vector(static_vector&&) requires std::is_trivially_copyable_v<T> = default;
+
+        // Nothrow
+        static_vector(static_vector&& rhs) noexcept
+        {
+            detail::uninitialized_relocate_n(rhs.data(), rhs.mSize, data());
+            mSize = std::exchange(rhs.mSize, 0);
+        }
+
+        static_vector& operator=(const static_vector&) requires std::is_trivially_copyable_v<T> = default;
+
+        // Strong
+        static_vector& operator=(const static_vector& rhs)
+        {
+            if (this != &rhs)
+            {
+                static_vector copy(rhs);
+                swap(*this, copy);
+            }
+
+            return *this;
+        }
+
+        static_vector& operator=(static_vector&&) requires std::is_trivially_copyable_v<T> = default;
+
+        // Nothrow
+        static_vector& operator=(static_vector&& rhs) noexcept
+        {
+            if (this != &rhs)
+            {
+                clear();
+
+                detail::uninitialized_relocate_n(rhs.data(), rhs.mSize, data());
+                mSize = std::exchange(rhs.mSize, 0);
+            }
+
+            return *this;
+        }
+
+        ~static_vector() requires std::is_trivially_destructible_v<T> = default;
+
+        // Nothrow
+        ~static_vector() noexcept
+        {
+            std::destroy_n(data(), mSize);
+        }
+
+        // Nothrow
+        std::size_t size() const noexcept { return mSize; }
+        static constexpr std::size_t capacity() noexcept { return N; }
+        static constexpr std::size_t max_size() noexcept { return N; }
+
+        // Strong
+        reference operator[](std::size_t index) { return data()[index]; }
+        const_reference operator[](std::size_t index) const { return data()[index]; }
+
+        // Nothrow
+        pointer data() noexcept { return reinterpret_cast<T*>(mStorage); }
+        const_pointer data() const noexcept { return reinterpret_cast<const T*>(mStorage); }
+
+        // Nothrow
+        bool empty() const noexcept { return mSize == 0; }
+        bool full() const noexcept { return mSize == N; }
+
+        iterator begin() noexcept { return data(); }
+        const_iterator begin() const noexcept { return data(); }
+        const_iterator cbegin() const noexcept { return data(); }
+
+        iterator end() noexcept { return data() + mSize; }
+        const_iterator end() const noexcept { return data() + mSize; }
+        const_iterator cend() const noexcept { return data() + mSize; }
+
+        // Strong
+        void push_back(const T& value)
+        {
+            emplace_back(value);
+        }
+
+        // Strong
+        void push_back(T&& value)
+        {
+            emplace_back(std::move(value));
+        }
+
+        // Strong
+        template <typename... Args>
+        reference emplace_back(Args&&... args)
+        {
+            check_capacity(mSize + std::size_t{ 1 });
+
+            T* location{ std::construct_at(end(), std::forward<Args>(args)...) };
+            ++mSize;
+
+            return *location;
+        }
+
+        // Nothrow
+        void pop_back() noexcept
+        {
+            std::destroy_at(data() + --mSize);
+        }
+
+        // Nothrow
+        void clear() noexcept
+        {
+            std::destroy_n(data(), mSize);
+            mSize = 0;
+        }
+
+        // Strong
+        void resize(std::size_t new_sz)
+        {
+            resize_with(new_sz);
+        }
+
+        // Strong
+        void resize(std::size_t new_sz, const value_type& init_value)
+        {
+            resize_with(new_sz, init_value);
+        }
+
+        // Strong. New elements are default-initialized: trivial ones are left for the caller to overwrite
+        void resize_for_overwrite(std::size_t new_sz)
+        {
+            resize_with(new_sz, detail::default_init);
+        }
+
+        // Strong
+        template <typename... Args>
+        iterator emplace(const_iterator pos, Args&&... args)
+        {
+            const auto pos_idx{ index_of(pos) };
+            
+            if (pos_idx == mSize)
+            {
+                emplace_back(std::forward<Args>(args)...);
+                return data() + pos_idx;
+            }
+
+            check_capacity(mSize + std::size_t{ 1 });
+            T value(std::forward<Args>(args)...); // args may refer to an element
+
+            detail::relocate_right(data() + pos_idx, end(), 1);
+            std::construct_at(data() + pos_idx, std::move(value));
+            ++mSize;
+
+            return data() + pos_idx;
+        }
+
+        // Strong
+        iterator insert(const_iterator pos, const T& value)
+        {
+            return emplace(pos, value);
+        }
+
+        // Strong
+        iterator insert(const_iterator pos, std::size_t n, const T& value)
+        {
+            check_capacity(mSize + n);
+            const T copy_value(value); // value may refer to an element
+
+            return insert_with(index_of(pos), n, [&](T* location)
+            {
+                detail::uninitialized_construct_with_args_n(n, location, copy_value);
+            });
+        }
+
+        // Strong
+        template <std::forward_iterator It>
+        iterator insert(const_iterator pos, It first, It last)
+        {
+            const auto n{ static_cast<std::size_t>(std::distance(first, last)) };
+            check_capacity(mSize + n);
+
+            return insert_with(index_of(pos), n, [&](T* location)
+            {
+                std::uninitialized_copy_n(first, n, location);
+            });
+        }
+
+        // Strong
+        iterator insert(const_iterator pos, std::initializer_list<T> list)
+        {
+            return insert(pos, std::begin(list), std::end(list));
+        }
+
+        // Nothrow
+        iterator erase(const_iterator pos) noexcept
+        {
+            return erase(pos, pos + 1);
+        }
+
+        // Nothrow
+        iterator erase(const_iterator first, const_iterator last) noexcept
+        {
+            const auto first_idx{ index_of(first) };
+            const auto count{ index_of(last) - first_idx };
+
+            if (count != 0)
+            {
+                std::destroy_n(data() + first_idx, count);
+                detail::relocate_left(data() + first_idx, end(), count);
+
+                mSize -= static_cast<stored_size_t>(count);
+            }
+
+            return data() + first_idx;
+        }
+
+        // Keeps the elements satisfying pred, returns the number of erased elements
+        template <typename Pred>
+        std::size_t retain(Pred pred)
+        {
+            return remove_if([&pred](const T& el) { return !pred(el); });
+        }
+
+        friend bool operator==(const static_vector& lhs, const static_vector& rhs)
+        {
+            return lhs.mSize == rhs.mSize && detail::equal_n(lhs.data(), rhs.data(), lhs.mSize);
+        }
+
+        friend auto operator<=>(const static_vector& lhs, const static_vector& rhs)
+            requires std::three_way_comparable<T>
+        {
+            const std::size_t common{ std::min<std::size_t>(lhs.mSize, rhs.mSize) };
+
+            if (const auto cmp{ detail::compare_three_way_n(lhs.data(), rhs.data(), common) }; cmp != 0)
+            {
+                return cmp;
+            }
+
+            return std::compare_three_way_result_t<T>{ lhs.mSize <=> rhs.mSize };
+        }
+
+        friend bool operator!=(const static_vector& lhs, const static_vector& rhs)
+        {
+            return !(lhs == rhs);
+        }
+
+        // Nothrow
+        friend void swap(static_vector& lhs, static_vector& rhs) noexcept
+        {
+            static_vector tmp(std::move(lhs));
+            lhs = std::move(rhs);
+            rhs = std::move(tmp);
+        }
+
+        template <typename U, std::size_t M, overflow::policy P, typename Pred>
+        friend std::size_t erase_if(static_vector<U, M, P>& vec, Pred pred);
+
+    private:
+        static void check_capacity(std::size_t required) noexcept(noexcept(OverflowPolicy::on_overflow()))
+        {
+            if (required > N) [[unlikely]] { OverflowPolicy::on_overflow(); }
+        }
+
+        std::size_t index_of(const_iterator pos) const noexcept
+        {
+            return static_cast<std::size_t>(pos - data());
+        }
+
+        // Strong
+        template <typename... Args>
+        void resize_with(std::size_t new_sz, const Args&... args)
+        {
+            if (new_sz < mSize)
+            {
+                std::destroy(data() + new_sz, end());
+            }
+            else if (new_sz > mSize)
+            {
+                check_capacity(new_sz);
+                detail::uninitialized_construct_with_args_n(new_sz - mSize, end(), args...);
+            }
+
+            mSize = static_cast<stored_size_t>(new_sz);
+        }
+
+        // Strong, capacity is already checked
+        template <typename Construct>
+        iterator insert_with(std::size_t pos_idx, std::size_t count, Construct&& construct)
+        {
+            if (count == 0) { return data() + pos_idx; }
+
+            detail::relocate_right(data() + pos_idx, end(), count);
+
+            try
+            {
+                construct(data() + pos_idx);
+            }
+            catch (...)
+            {
+                detail::relocate_left(data() + pos_idx, end() + count, count);
+                throw;
+            }
+
+            mSize += static_cast<stored_size_t>(count);
+            return data() + pos_idx;
+        }
+
+        template <typename Pred>
+        std::size_t remove_if(Pred&& pred)
+        {
+            std::size_t sz{ mSize };
+
+            try
+            {
+                detail::relocate_remove_if(data(), sz, pred);
+            }
+            catch (...)
+            {
+                mSize = static_cast<stored_size_t>(sz);
+                throw;
+            }
+
+            const auto erased{ mSize - sz };
+            mSize = static_cast<stored_size_t>(sz);
+
+            return erased;
+        }
+
+    private:
+        using stored_size_t = detail::compact_size_t<N>; // the smallest type holding N keeps small vectors small
+
+        alignas(T) std::byte mStorage[N * sizeof(T)];
+        stored_size_t mSize{};
+    };
+
+    // Returns the number of erased elements
+    template <typename T, std::size_t N, overflow::policy OverflowPolicy, typename Pred>
+    std::size_t erase_if(static_vector<T, N, OverflowPolicy>& vec, Pred pred)
+    {
+        return vec.remove_if(pred);
+    }
+
+    // Returns the number of erased elements
+    template <typename T, std::size_t N, overflow::policy OverflowPolicy, typename U>
+    std::size_t erase(static_vector<T, N, OverflowPolicy>& vec, const U& value)
+    {
+        const U copy_value(value); // value may refer to an element
+        return erase_if(vec, [&copy_value](const T& el) { return el == copy_value; });
+    }
+
+} // namespace vectorx
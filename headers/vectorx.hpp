@@ -23,25 +23,309 @@
 #pragma once
 
 #include <cstddef>
+#include <cstdint>
+#include <cstdlib>
 #include <cstring>
+#include <limits>
+#include <new>
 #include <iterator>
 #include <memory>
+#include <memory_resource>
 #include <initializer_list>
 #include <utility>
 #include <algorithm>
 #include <concepts>
 #include <type_traits>
+#include <compare>
+#include <ranges>
+#include <atomic>
+#include <exception>
+#include <system_error>
+#include <thread>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
 
 namespace vectorx 
 {
+    // Customization point: specialize for types whose move + destroy of the source
+    // is equivalent to a raw byte copy (e.g. owning handles without self-pointers).
+    template <typename T>
+    struct is_trivially_relocatable 
+        : std::bool_constant<std::is_trivially_copyable_v<T>> 
+    { };
+
+    template <typename T>
+    struct is_trivially_relocatable<std::unique_ptr<T>> 
+        : std::true_type 
+    { };
+
+    template <typename T>
+    inline constexpr bool is_trivially_relocatable_v = is_trivially_relocatable<T>::value;
+
+    // Disambiguation tag for range constructors, std::from_range_t where the library has it
+#if defined(__cpp_lib_containers_ranges)
+    using std::from_range_t;
+    using std::from_range;
+#else
+    struct from_range_t { explicit from_range_t() = default; };
+    inline constexpr from_range_t from_range{};
+#endif
+
+    // Tuning for bulk uninitialized copies, fills and relocations (copy construction, resize, range construction,
+    // growth). Without being asked, only memcpy-like work is split: trivially copyable elements copied from
+    // contiguous sources or filled, and trivially relocatable ones moved to a new block. Overloads taking `par`
+    // split any copy or relocation, so T's constructors run on several threads.
+    namespace parallel
+    {
+        // Operations touching at least this many bytes are split across threads, SIZE_MAX turns splitting off
+        inline std::atomic<std::size_t> threshold_bytes{ std::size_t{ 64 } << 20 };
+
+        // Threads per operation including the caller, 0 means std::thread::hardware_concurrency()
+        inline std::atomic<unsigned> max_threads{ 0 };
+
+        // Execution policy tag, the caller vouches that element copies may run concurrently
+        struct par_t { explicit par_t() = default; };
+        inline constexpr par_t par{};
+    } // namespace parallel
+
+    // Allocation statistics of vectors using growth::tracked, other vectors carry and record nothing
+    namespace stats
+    {
+        struct counters
+        {
+            std::size_t allocations{};
+            std::size_t bytes_allocated{};
+            // Blocks obtained to change the capacity of a vector already holding one
+            std::size_t reallocations{};
+            // Elements moved, copied or relocated bytewise into a new block by those reallocations
+            std::size_t elements_relocated{};
+            // Largest block held, in bytes so totals over different element types stay comparable
+            std::size_t peak_bytes{};
+
+            constexpr counters& operator+=(const counters& rhs) noexcept
+            {
+                allocations += rhs.allocations;
+                bytes_allocated += rhs.bytes_allocated;
+                reallocations += rhs.reallocations;
+                elements_relocated += rhs.elements_relocated;
+                peak_bytes = std::max(peak_bytes, rhs.peak_bytes);
+
+                return *this;
+            }
+
+            friend constexpr bool operator==(const counters&, const counters&) noexcept = default;
+        };
+    } // namespace stats
+
+    namespace detail
+    {
+        // Relaxed counters: they are only read for reporting and never order other memory
+        struct StatsRegistry
+        {
+            void add(const stats::counters& delta) noexcept
+            {
+                mAllocations.fetch_add(delta.allocations, std::memory_order_relaxed);
+                mBytesAllocated.fetch_add(delta.bytes_allocated, std::memory_order_relaxed);
+                mReallocations.fetch_add(delta.reallocations, std::memory_order_relaxed);
+                mElementsRelocated.fetch_add(delta.elements_relocated, std::memory_order_relaxed);
+
+                auto peak{ mPeakBytes.load(std::memory_order_relaxed) };
+                while (peak < delta.peak_bytes && !mPeakBytes.compare_exchange_weak(peak, delta.peak_bytes, std::memory_order_relaxed))
+                { }
+            }
+
+            stats::counters load() const noexcept
+            {
+                return stats::counters{
+                    .allocations = mAllocations.load(std::memory_order_relaxed),
+                    .bytes_allocated = mBytesAllocated.load(std::memory_order_relaxed),
+                    .reallocations = mReallocations.load(std::memory_order_relaxed),
+                    .elements_relocated = mElementsRelocated.load(std::memory_order_relaxed),
+                    .peak_bytes = mPeakBytes.load(std::memory_order_relaxed),
+                };
+            }
+
+            void reset() noexcept
+            {
+                for (auto* counter : { &mAllocations, &mBytesAllocated, &mReallocations, &mElementsRelocated, &mPeakBytes })
+                {
+                    counter->store(0, std::memory_order_relaxed);
+                }
+            }
+
+            std::atomic<std::size_t> mAllocations{};
+            std::atomic<std::size_t> mBytesAllocated{};
+            std::atomic<std::size_t> mReallocations{};
+            std::atomic<std::size_t> mElementsRelocated{};
+            std::atomic<std::size_t> mPeakBytes{};
+        };
+
+        inline StatsRegistry stats_registry{};
+
+        // Stands in for stats::counters in vectors that don't track them
+        struct NoStats { };
+    } // namespace detail
+
+    namespace stats
+    {
+        // Totals over every tracked vector of the program. Taken field by field while other threads keep
+        // counting, so the fields may come from slightly different moments.
+        inline counters global() noexcept
+        {
+            return detail::stats_registry.load();
+        }
+
+        inline void reset_global() noexcept
+        {
+            detail::stats_registry.reset();
+        }
+    } // namespace stats
+
     namespace detail
     {
-        template <typename T, typename Alloc = std::allocator<T>>
+        // Reverses the bytes of an unsigned integer, std::byteswap is C++23
+        template <std::unsigned_integral U>
+        constexpr U byteswap(U value) noexcept
+        {
+            U swapped{};
+            for (std::size_t i{}; i < sizeof(U); ++i)
+            {
+                swapped = static_cast<U>((swapped << 8) | (value & 0xFF));
+                value = static_cast<U>(value >> 8);
+            }
+
+            return swapped;
+        }
+
+        static_assert(byteswap(std::uint32_t{ 0x0102'0304 }) == 0x0403'0201);
+
+        namespace pages
+        {
+#if defined(__linux__)
+            inline constexpr bool is_supported{ true };
+#else
+            inline constexpr bool is_supported{ false };
+#endif
+
+            inline std::size_t size() noexcept
+            {
+#if defined(__linux__)
+                static const auto page_sz{ static_cast<std::size_t>(::sysconf(_SC_PAGESIZE)) };
+                return page_sz;
+#else
+                return 4096;
+#endif
+            }
+
+            // Transparent huge page size on x86-64 and aarch64 with 4K base pages
+            inline constexpr std::size_t huge_size{ std::size_t{ 2 } << 20 };
+
+            inline std::size_t round_up(std::size_t bytes) noexcept
+            {
+                const auto page_sz{ size() };
+                return (bytes + page_sz - 1) / page_sz * page_sz;
+            }
+
+            // Throws std::bad_alloc. Huge mappings start on a huge page boundary and are advised for THP backing.
+            inline void* map(std::size_t bytes, bool huge = false)
+            {
+#if defined(__linux__)
+                const auto length{ round_up(bytes) };
+
+                if (!huge)
+                {
+                    void* ptr{ ::mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0) };
+                    if (ptr != MAP_FAILED) { return ptr; }
+                }
+                else 
+                {
+                    // Over-map by one huge page and trim both ends to get an aligned range
+                    void* raw{ ::mmap(nullptr, length + huge_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0) };
+                    if (raw != MAP_FAILED)
+                    {
+                        auto* first{ static_cast<std::byte*>(raw) };
+                        auto* aligned{ first + (huge_size - reinterpret_cast<std::uintptr_t>(first) % huge_size) % huge_size };
+
+                        if (aligned != first) { ::munmap(first, static_cast<std::size_t>(aligned - first)); }
+                        ::munmap(aligned + length, static_cast<std::size_t>(first + length + huge_size - (aligned + length)));
+
+#if defined(MADV_HUGEPAGE)
+                        ::madvise(aligned, length, MADV_HUGEPAGE); // best effort, THP may be disabled
+#endif
+                        return aligned;
+                    }
+                }
+#endif
+                (void)bytes; (void)huge;
+                throw std::bad_alloc{};
+            }
+
+            inline void unmap(void* ptr, std::size_t bytes) noexcept
+            {
+#if defined(__linux__)
+                ::munmap(ptr, round_up(bytes));
+#endif
+                (void)ptr; (void)bytes;
+            }
+
+            // Returns nullptr if the mapping can't be resized (in place when !may_move)
+            inline void* remap(void* ptr, std::size_t old_bytes, std::size_t new_bytes, bool may_move) noexcept
+            {
+#if defined(__linux__)
+                const auto old_sz{ round_up(old_bytes) };
+                const auto new_sz{ round_up(new_bytes) };
+                if (old_sz == new_sz) { return ptr; }
+
+                void* new_ptr{ ::mremap(ptr, old_sz, new_sz, may_move ? MREMAP_MAYMOVE : 0) };
+                return new_ptr == MAP_FAILED ? nullptr : new_ptr;
+#else
+                (void)ptr; (void)old_bytes; (void)new_bytes; (void)may_move;
+                return nullptr;
+#endif
+            }
+
+            // Drops the physical pages of a mapped range, they read back as zero on the next access
+            inline void release(void* ptr, std::size_t bytes) noexcept
+            {
+#if defined(__linux__)
+                if (bytes != 0) { ::madvise(ptr, bytes, MADV_DONTNEED); }
+#endif
+                (void)ptr; (void)bytes;
+            }
+        } // namespace pages
+
+        // Alignment raises the alignment of the block above alignof(T), HugePages maps large blocks with 2 MB pages.
+        // Both need the default allocator.
+        template <typename T, typename Alloc = std::allocator<T>, std::size_t Alignment = alignof(T), bool HugePages = false>
         class Buffer
         {
         public:
             using alloc_traits = std::allocator_traits<Alloc>;
 
+            static constexpr std::size_t alignment{ std::max(Alignment, alignof(T)) };
+
+            static_assert((alignment & (alignment - 1)) == 0, "alignment must be a power of two");
+            static_assert(std::is_same_v<Alloc, std::allocator<T>> || (alignment == alignof(T) && !HugePages), 
+                          "custom alignment and huge pages require std::allocator");
+
+            // Default allocator + relocatable T: storage comes from malloc/mmap so it can be grown by realloc/mremap
+            static constexpr bool is_reallocatable{ std::is_same_v<Alloc, std::allocator<T>> && 
+                                                    is_trivially_relocatable_v<T> && 
+                                                    alignment <= alignof(std::max_align_t) };
+
+            // Storage is managed here rather than by the allocator
+            static constexpr bool is_raw{ is_reallocatable || 
+                                          (std::is_same_v<Alloc, std::allocator<T>> && (alignment != alignof(T) || HugePages)) };
+
+            // Blocks of at least this many bytes are page mapped
+            static constexpr std::size_t mapped_threshold{ HugePages ? pages::huge_size : std::size_t{ 64 } << 20 };
+
+            // Number of elements stored inside the buffer object itself
+            static constexpr std::size_t inline_capacity{ 0 };
+
         public:
             constexpr Buffer() 
                 : mAlloc{}
@@ -57,13 +341,13 @@ namespace vectorx
 
             explicit constexpr Buffer(std::size_t capacity, const Alloc& alloc = Alloc{}) 
                 : mAlloc{ alloc }
-                , mBuffer{ alloc_traits::allocate(mAlloc, capacity) }
+                , mBuffer{ allocate(capacity) }
                 , mCapacity{ capacity }
             { }
 
             constexpr Buffer(const Buffer& rhs) 
-                : mAlloc{ rhs.mAlloc }
-                , mBuffer{ alloc_traits::allocate(mAlloc, rhs.mCapacity) }
+                : mAlloc{ alloc_traits::select_on_container_copy_construction(rhs.mAlloc) }
+                , mBuffer{ allocate(rhs.mCapacity) }
                 , mCapacity{ rhs.mCapacity }
             { }
 
@@ -77,19 +361,48 @@ namespace vectorx
             {
                 if (this != &rhs)
                 {
-                    Buffer copy{ rhs };
-                    swap(*this, copy);
+                    if constexpr (alloc_traits::propagate_on_container_copy_assignment::value)
+                    {
+                        Buffer copy{ rhs.mCapacity, rhs.mAlloc };
+                        swap_storage(*this, copy);
+
+                        using std::swap;
+                        swap(mAlloc, copy.mAlloc);
+                    }
+                    else 
+                    {
+                        Buffer copy{ rhs.mCapacity, mAlloc };
+                        swap_storage(*this, copy);
+                    }
                 }
 
                 return *this;
             }
 
-            constexpr Buffer& operator=(Buffer&& rhs) noexcept
+            constexpr Buffer& operator=(Buffer&& rhs) noexcept(alloc_traits::propagate_on_container_move_assignment::value || 
+                                                               alloc_traits::is_always_equal::value)
             {
                 if (this != &rhs) // *
                 {   
-                    alloc_traits::deallocate(mAlloc, mBuffer, mCapacity);
-                    mAlloc = std::move(rhs.mAlloc);
+                    if constexpr (!alloc_traits::propagate_on_container_move_assignment::value && 
+                                  !alloc_traits::is_always_equal::value)
+                    {
+                        if (mAlloc != rhs.mAlloc) // storage of an unequal allocator can't be adopted
+                        {
+                            Buffer copy{ rhs.mCapacity, mAlloc };
+                            swap_storage(*this, copy);
+
+                            Buffer released{ std::move(rhs) };
+                            return *this;
+                        }
+                    }
+
+                    deallocate(mBuffer, mCapacity);
+                    
+                    if constexpr (alloc_traits::propagate_on_container_move_assignment::value)
+                    {
+                        mAlloc = std::move(rhs.mAlloc);
+                    }
 
                     mBuffer = std::exchange(rhs.mBuffer, nullptr); 
                     mCapacity = std::exchange(rhs.mCapacity, 0);
@@ -102,7 +415,7 @@ namespace vectorx
             {
                 if (mCapacity != 0 && mBuffer != nullptr)
                 {
-                    alloc_traits::deallocate(mAlloc, mBuffer, mCapacity);
+                    deallocate(mBuffer, mCapacity);
                 }
             }
 
@@ -126,442 +439,1938 @@ namespace vectorx
                 return mAlloc;
             }
 
-            friend void swap(Buffer& lhs, Buffer& rhs) noexcept
+            constexpr const Alloc& get_allocator() const
             {
-                using std::swap;
-
-                swap(lhs.mAlloc, rhs.mAlloc);
-                swap(lhs.mBuffer, rhs.mBuffer);
-                swap(lhs.mCapacity, rhs.mCapacity);
+                return mAlloc;
             }
 
-        private:
-            Alloc mAlloc;
-            
-            T* mBuffer;
-            std::size_t mCapacity;
-        };
-
-        template <typename T, typename... Args>
-        void uninitialized_construct_with_args_n(std::size_t n, T* location, Args&&... args)
-        {
-            std::size_t i{};
-
-            try
+            // Nothrow, grows the block without moving it
+            constexpr bool try_expand(std::size_t capacity) noexcept
             {
-                for (; i < n; ++i)
+                if (capacity <= mCapacity) { return true; }
+
+                if constexpr (is_reallocatable && pages::is_supported)
                 {
-                    std::construct_at(location + i, std::forward<Args>(args)...);
+                    if (!std::is_constant_evaluated() && is_mapped(mCapacity) && is_mapped(capacity))
+                    {
+                        if (pages::remap(mBuffer, bytes(mCapacity), bytes(capacity), false) != nullptr)
+                        {
+                            mCapacity = capacity;
+                            return true;
+                        }
+                    }
                 }
+
+                return false;
             }
-            catch (...)
-            {
-                std::destroy_n(location, i);
-                throw;
-            }
-        } 
-    } // namespace detail
 
-    template <typename T, typename Alloc = std::allocator<T>>
-        requires std::is_nothrow_move_assignable_v<T> &&
-                 std::is_nothrow_move_constructible_v<T>
-    class vector
-    {
-    public:
-        class iterator;
+            // Strong, contents are preserved bytewise and the block may move
+            void reallocate(std::size_t capacity)
+                requires is_reallocatable
+            {
+                if (capacity <= mCapacity || try_expand(capacity)) { return; }
+                if (capacity > std::numeric_limits<std::size_t>::max() / sizeof(T)) { throw std::bad_array_new_length{}; }
 
-        using value_type = T;
-        using allocator_type = Alloc;
-        using size_type = std::size_t;
-        using difference_type = std::ptrdiff_t;
-        using reference = value_type&;
-        using const_reference = const value_type&;
-        using pointer = typename std::allocator_traits<Alloc>::pointer;
-        using const_pointer = typename std::allocator_traits<Alloc>::const_pointer;
-        using iterator = iterator;
-        using const_iterator = const iterator;
+                T* ptr{};
+                if (!HugePages && is_mapped(mCapacity) && is_mapped(capacity)) // a moving mremap drops the huge page alignment
+                {
+                    ptr = static_cast<T*>(pages::remap(mBuffer, bytes(mCapacity), bytes(capacity), true));
+                    if (ptr == nullptr) { throw std::bad_alloc{}; }
+                }
+                else if (!is_mapped(mCapacity) && !is_mapped(capacity))
+                {
+                    ptr = static_cast<T*>(std::realloc(static_cast<void*>(mBuffer), bytes(capacity)));
+                    if (ptr == nullptr) { throw std::bad_alloc{}; }
+                }
+                else 
+                {
+                    ptr = allocate(capacity);
+                    if (mCapacity != 0) 
+                    { 
+                        std::memcpy(static_cast<void*>(ptr), static_cast<const void*>(mBuffer), bytes(mCapacity)); 
+                    }
 
-        using buffer_t = detail::Buffer<T, Alloc>;
+                    deallocate(mBuffer, mCapacity);
+                }
 
-    public:
-        class iterator
-        {
-        public:
-            // ?
-            using iterator_category = std::random_access_iterator_tag;
-            using difference_type = std::ptrdiff_t;
-            using value_type = T;
-            using pointer = T*;
-            using const_pointer = const T*;
-            using reference = T&;
-            using const_reference = const T&;
+                mBuffer = ptr;
+                mCapacity = capacity;
+            }
 
-        public:
-            iterator() 
-                : mPtr{ nullptr }
-            { }
+            // Strong, contents up to `capacity` are preserved bytewise. Mapped blocks shrink in place.
+            void shrink(std::size_t capacity)
+                requires is_reallocatable
+            {
+                if (capacity >= mCapacity) { return; }
 
-            explicit iterator(pointer ptr) 
-                : mPtr{ ptr }
-            { }
+                if (capacity == 0)
+                {
+                    deallocate(mBuffer, mCapacity);
+                    mBuffer = nullptr;
+                }
+                else if (is_mapped(mCapacity) && is_mapped(capacity))
+                {
+                    if (pages::remap(mBuffer, bytes(mCapacity), bytes(capacity), false) == nullptr) { return; }
+                }
+                else if (!is_mapped(mCapacity) && !is_mapped(capacity))
+                {
+                    void* ptr{ std::realloc(static_cast<void*>(mBuffer), bytes(capacity)) };
+                    if (ptr == nullptr) { return; } // the old block is left intact
 
-            pointer operator->() { return mPtr; }
-            const_pointer operator->() const { return mPtr; }
+                    mBuffer = static_cast<T*>(ptr);
+                }
+                else 
+                {
+                    T* ptr{ allocate(capacity) };
+                    std::memcpy(static_cast<void*>(ptr), static_cast<const void*>(mBuffer), bytes(capacity));
 
-            reference operator*() { return *mPtr; }
-            const_reference operator*() const { return *mPtr; }
+                    deallocate(mBuffer, mCapacity);
+                    mBuffer = ptr;
+                }
 
-            iterator& operator++()
-            {
-                ++mPtr;
-                return *this;
+                mCapacity = capacity;
             }
 
-            iterator operator++(int)
+            // Nothrow, returns the whole pages past the first `used` elements of a mapped block to the OS
+            constexpr void release_unused(std::size_t used) noexcept
             {
-                auto cp{ *this };
-                ++(*this);
+                if constexpr (is_raw && pages::is_supported)
+                {
+                    if (!std::is_constant_evaluated() && is_mapped(mCapacity))
+                    {
+                        const auto first{ pages::round_up(bytes(used)) };
+                        const auto last{ pages::round_up(bytes(mCapacity)) };
 
-                return cp;
+                        if (first < last) { pages::release(reinterpret_cast<std::byte*>(mBuffer) + first, last - first); }
+                    }
+                }
             }
 
-            iterator& operator--()
+            friend void swap(Buffer& lhs, Buffer& rhs) noexcept
             {
-                --mPtr;
-                return *this;
+                using std::swap;
+
+                if constexpr (alloc_traits::propagate_on_container_swap::value)
+                {
+                    swap(lhs.mAlloc, rhs.mAlloc);
+                }
+
+                swap_storage(lhs, rhs);
             }
 
-            iterator operator--(int)
+        private:
+            static constexpr void swap_storage(Buffer& lhs, Buffer& rhs) noexcept
             {
-                auto cp{ *this };
-                --(*this);
+                using std::swap;
 
-                return cp;
+                swap(lhs.mBuffer, rhs.mBuffer);
+                swap(lhs.mCapacity, rhs.mCapacity);
             }
 
-            iterator& operator+=(std::size_t offset)
-            {
-                mPtr += offset;
-                return *this;
+            static constexpr std::size_t bytes(std::size_t n) noexcept { return n * sizeof(T); }
+            // Mappings are page aligned, 4K being the smallest page size around
+            static constexpr bool is_mapped(std::size_t n) noexcept 
+            { 
+                return pages::is_supported && alignment <= 4096 && bytes(n) >= mapped_threshold; 
             }
 
-            iterator& operator-=(std::size_t offset)
+            constexpr T* allocate(std::size_t n)
             {
-                mPtr -= offset;
-                return *this;
-            }
+                if constexpr (is_raw)
+                {
+                    if (!std::is_constant_evaluated())
+                    {
+                        if (n == 0) { return nullptr; }
+                        if (n > std::numeric_limits<std::size_t>::max() / sizeof(T)) { throw std::bad_array_new_length{}; }
 
-            reference operator[](std::size_t index) { return mPtr[index]; }
-            const_reference operator[](std::size_t index) const { return mPtr[index]; }
+                        if (is_mapped(n)) { return static_cast<T*>(pages::map(bytes(n), HugePages)); }
 
-            friend bool operator==(iterator lhs, iterator rhs) noexcept { return lhs.equals(rhs); }
-            friend bool operator!=(iterator lhs, iterator rhs) noexcept { return !lhs.equals(rhs); }
-            friend bool operator>=(iterator lhs, iterator rhs) noexcept { return lhs.mPtr >= rhs.mPtr; }
-            friend bool operator<=(iterator lhs, iterator rhs) noexcept { return lhs.mPtr <= rhs.mPtr; }
-            friend bool operator>(iterator lhs, iterator rhs) noexcept { return lhs.mPtr > rhs.mPtr; }
-            friend bool operator<(iterator lhs, iterator rhs) noexcept { return lhs.mPtr < rhs.mPtr; }
+                        void* ptr{};
+                        if constexpr (alignment <= alignof(std::max_align_t)) { ptr = std::malloc(bytes(n)); }
+                        else { ptr = std::aligned_alloc(alignment, (bytes(n) + alignment - 1) / alignment * alignment); }
 
-            friend iterator operator+(iterator it, difference_type n) { it += n; return it; }
-            friend iterator operator-(iterator it, difference_type n) { it -= n; return it; }
-            friend iterator operator+(difference_type n, iterator it) { return it + n; }
-            friend difference_type operator-(iterator lhs, iterator rhs) { return lhs.mPtr - rhs.mPtr; }
+                        if (ptr == nullptr) { throw std::bad_alloc{}; }
+                        return static_cast<T*>(ptr);
+                    }
+                }
 
-        private:
-            bool equals(iterator rhs) const noexcept { return mPtr == rhs.mPtr; }
+                if (n == 0) { return nullptr; }
+                return alloc_traits::allocate(mAlloc, n);
+            }
 
-        private:
-            pointer mPtr;
-        };
+            constexpr void deallocate(T* ptr, std::size_t n) noexcept
+            {
+                if constexpr (is_raw)
+                {
+                    if (!std::is_constant_evaluated())
+                    {
+                        if (is_mapped(n)) { pages::unmap(ptr, bytes(n)); }
+                        else { std::free(ptr); }
 
-    public:
-        // Nothrow
-        constexpr vector() = default;
+                        return;
+                    }
+                }
 
-        // Nothrow if alloc nothrow
-        constexpr vector(const Alloc& alloc)
-            : mBuffer{ alloc }
-            , mSize{}
-        { }
+                alloc_traits::deallocate(mAlloc, ptr, n);
+            }
 
-        // Strong 
-        constexpr vector(std::size_t capacity, const Alloc& alloc = Alloc{})
-            : mBuffer{ capacity, alloc }
-            , mSize{}
-        { }
+        private:
+            Alloc mAlloc;
+            
+            T* mBuffer;
+            std::size_t mCapacity;
+        };
 
-        // Strong
-        constexpr vector(std::initializer_list<T> list, const Alloc& alloc = Alloc{}) 
-            : mBuffer{ std::size(list), alloc }
-            , mSize{}
+        // Argument tag selecting default- rather than value-initialization
+        struct default_init_t { explicit default_init_t() = default; };
+        inline constexpr default_init_t default_init{};
+
+        // Number of threads a bulk operation over `bytes` should use, 1 below the threshold
+        inline unsigned parallel_chunk_count(std::size_t bytes) noexcept
         {
-            const auto sz{ std::size(list) };
+            if (bytes < parallel::threshold_bytes.load(std::memory_order_relaxed)) { return 1; }
 
-            std::uninitialized_copy_n(std::begin(list), sz, std::data(mBuffer));
-            mSize = sz;
+            const unsigned threads{ parallel::max_threads.load(std::memory_order_relaxed) };
+            return threads != 0 ? threads : std::max(std::thread::hardware_concurrency(), 1u);
         }
 
-        // Strong
-        constexpr vector(const vector& rhs)
-            : mBuffer{ rhs.mBuffer }
-            , mSize{}
+        // Runs run(first, last) over `chunks` slices of [0, n), slice 0 on the calling thread. run must leave its
+        // slice untouched when it throws. If any slice throws, undo(first, last) is called for every slice that
+        // completed and the first exception is rethrown. Slices whose thread can't be started run on the caller.
+        template <typename Run, typename Undo>
+        void parallel_chunks(std::size_t n, unsigned chunks, Run& run, Undo& undo)
         {
-            std::uninitialized_copy_n(std::data(rhs.mBuffer), rhs.mSize, std::data(mBuffer));
-            mSize = rhs.mSize;
-        }
+            auto bound{ [n, chunks](unsigned chunk) { return n / chunks * chunk + std::min<std::size_t>(chunk, n % chunks); } };
 
-        // Nothrow
-        constexpr vector(vector&& rhs) noexcept
-            : mBuffer{ std::move(rhs.mBuffer) }
-            , mSize{ std::exchange(rhs.mSize, 0) }
-        { }
+            std::unique_ptr<std::exception_ptr[]> errors{ new std::exception_ptr[chunks] };
+            auto task{ [&](unsigned chunk)
+            {
+                try
+                {
+                    run(bound(chunk), bound(chunk + 1));
+                }
+                catch (...)
+                {
+                    errors[chunk] = std::current_exception();
+                }
+            } };
 
-        // Strong
-        constexpr vector& operator=(const vector& rhs)
-        {
-            if (this != &rhs)
             {
-                vector copy(rhs);
-                swap(*this, copy);
+                std::unique_ptr<std::jthread[]> workers{ new std::jthread[chunks - 1] };
+
+                unsigned spawned{};
+                for (; spawned < chunks - 1; ++spawned)
+                {
+                    try
+                    {
+                        workers[spawned] = std::jthread{ task, spawned + 1 };
+                    }
+                    catch (...) // std::system_error or std::bad_alloc for the thread state, the thread never started
+                    {
+                        break;
+                    }
+                }
+
+                for (unsigned chunk{ spawned + 1 }; chunk < chunks; ++chunk) { task(chunk); }
+                task(0);
+            } // joins the workers
+
+            const auto* failed{ std::find_if(errors.get(), errors.get() + chunks, [](const auto& error) { return error != nullptr; }) };
+            if (failed == errors.get() + chunks) { return; }
+
+            for (unsigned chunk{}; chunk < chunks; ++chunk)
+            {
+                if (errors[chunk] == nullptr) { undo(bound(chunk), bound(chunk + 1)); }
             }
 
-            return *this;
+            std::rethrow_exception(*failed);
         }
 
-        // Nothrow
-        constexpr vector& operator=(vector&& rhs) noexcept // *
+        // Splits across threads past parallel::threshold_bytes when Split
+        template <bool Split, typename T, typename... Args>
+        void uninitialized_construct_with_args_n_split(std::size_t n, T* location, Args&&... args)
         {
-            if (this != &rhs)
+            auto construct{ [&](std::size_t first, std::size_t last)
             {
-                std::destroy_n(std::data(mBuffer), mSize);
+                std::size_t i{ first };
 
-                mSize = std::exchange(rhs.mSize, 0);
-                mBuffer = std::move(rhs.mBuffer);
+                try
+                {
+                    for (; i < last; ++i)
+                    {
+                        std::construct_at(location + i, std::forward<Args>(args)...);
+                    }
+                }
+                catch (...)
+                {
+                    std::destroy(location + first, location + i);
+                    throw;
+                }
+            } };
+
+            // Only const lvalue arguments can be shared between threads
+            if constexpr (Split && ((std::is_lvalue_reference_v<Args> && std::is_const_v<std::remove_reference_t<Args>>) && ...))
+            {
+                if (const auto chunks{ parallel_chunk_count(n * sizeof(T)) }; chunks > 1 && n >= chunks)
+                {
+                    auto destroy{ [location](std::size_t first, std::size_t last) { std::destroy(location + first, location + last); } };
+                    parallel_chunks(n, chunks, construct, destroy);
+
+                    return;
+                }
             }
 
-            return *this;
+            construct(0, n);
         }
 
-        // Nothrow
-        constexpr ~vector() noexcept 
+        // Value-initializing or copying a trivially copyable T runs no user code
+        template <typename T, typename... Args>
+        inline constexpr bool is_bitwise_construction_v{ std::is_trivially_copyable_v<T> && 
+            ((sizeof...(Args) == 0 && std::is_trivially_default_constructible_v<T>) || 
+             (sizeof...(Args) == 1 && (std::same_as<std::remove_cvref_t<Args>, T> && ...))) };
+
+        template <typename T, typename... Args>
+        void uninitialized_construct_with_args_n(std::size_t n, T* location, Args&&... args)
         {
-            std::destroy_n(std::data(mBuffer), mSize);
+            uninitialized_construct_with_args_n_split<is_bitwise_construction_v<T, Args...>>(n, location, std::forward<Args>(args)...);
         }
 
+        template <typename T, typename... Args>
+        void uninitialized_construct_with_args_n(parallel::par_t, std::size_t n, T* location, Args&&... args)
+        {
+            uninitialized_construct_with_args_n_split<true>(n, location, std::forward<Args>(args)...);
+        }
+
+        // Default-initializes n objects, trivially default-constructible ones are left indeterminate
+        template <typename T>
+        void uninitialized_construct_with_args_n(std::size_t n, T* location, default_init_t)
+        {
+            std::uninitialized_default_construct_n(location, n);
+        }
+
+        template <typename It, typename T>
+        constexpr void uninitialized_copy_n_sequential(It first, std::size_t n, T* d_first)
+        {
+            if constexpr (std::contiguous_iterator<It> && 
+                          std::is_trivially_copyable_v<T> &&
+                          std::same_as<std::remove_cv_t<std::iter_value_t<It>>, T>)
+            {
+                if (!std::is_constant_evaluated())
+                {
+                    if (n != 0)
+                    {
+                        std::memcpy(static_cast<void*>(d_first), static_cast<const void*>(std::to_address(first)), n * sizeof(T));
+                    }
+
+                    return;
+                }
+            }
+
+            std::uninitialized_copy_n(first, n, d_first);
+        }
+
+        // Splits across threads past parallel::threshold_bytes when Split. Ranges must not overlap.
+        template <bool Split, typename It, typename T>
+        constexpr void uninitialized_copy_n_split(It first, std::size_t n, T* d_first)
+        {
+            if constexpr (Split && std::random_access_iterator<It>)
+            {
+                if (!std::is_constant_evaluated())
+                {
+                    if (const auto chunks{ parallel_chunk_count(n * sizeof(T)) }; chunks > 1 && n >= chunks)
+                    {
+                        auto copy{ [&](std::size_t from, std::size_t to) 
+                        { 
+                            uninitialized_copy_n_sequential(first + static_cast<std::iter_difference_t<It>>(from), to - from, d_first + from); 
+                        } };
+                        auto destroy{ [d_first](std::size_t from, std::size_t to) { std::destroy(d_first + from, d_first + to); } };
+
+                        parallel_chunks(n, chunks, copy, destroy);
+                        return;
+                    }
+                }
+            }
+
+            uninitialized_copy_n_sequential(first, n, d_first);
+        }
+
+        // Copies n objects into uninitialized storage, as one memcpy when the source is contiguous and T is 
+        // trivially copyable. Only those copies are split across threads. Ranges must not overlap.
+        template <typename It, typename T>
+        constexpr void uninitialized_copy_n(It first, std::size_t n, T* d_first)
+        {
+            constexpr bool is_memcpy{ std::contiguous_iterator<It> && 
+                                      std::is_trivially_copyable_v<T> &&
+                                      std::same_as<std::remove_cv_t<std::iter_value_t<It>>, T> };
+
+            uninitialized_copy_n_split<is_memcpy>(first, n, d_first);
+        }
+
+        // Splits any random access copy, dereferencing the source and copying T on several threads
+        template <typename It, typename T>
+        constexpr void uninitialized_copy_n(parallel::par_t, It first, std::size_t n, T* d_first)
+        {
+            uninitialized_copy_n_split<true>(first, n, d_first);
+        }
+
+        template <typename T>
+        constexpr void uninitialized_relocate_n_sequential(T* first, std::size_t n, T* d_first) noexcept
+        {
+            if constexpr (is_trivially_relocatable_v<T>)
+            {
+                if (!std::is_constant_evaluated())
+                {
+                    if (n != 0) 
+                    { 
+                        std::memcpy(static_cast<void*>(d_first), static_cast<const void*>(first), n * sizeof(T)); 
+                    }
+                    
+                    return;
+                }
+            }
+
+            std::uninitialized_move_n(first, n, d_first);
+            std::destroy_n(first, n);
+        }
+
+        // Splits across threads past parallel::threshold_bytes when Split. Ranges must not overlap.
+        template <bool Split, typename T>
+        constexpr void uninitialized_relocate_n_split(T* first, std::size_t n, T* d_first) noexcept
+        {
+            if constexpr (Split)
+            {
+                if (!std::is_constant_evaluated())
+                {
+                    if (const auto chunks{ parallel_chunk_count(n * sizeof(T)) }; chunks > 1 && n >= chunks)
+                    {
+                        auto relocate{ [=](std::size_t from, std::size_t to) { uninitialized_relocate_n_sequential(first + from, to - from, d_first + from); } };
+                        auto nothing{ [](std::size_t, std::size_t) { } };
+
+                        try
+                        {
+                            parallel_chunks(n, chunks, relocate, nothing); // slices can't throw, moves are nothrow
+                            return;
+                        }
+                        catch (...) {} // only the bookkeeping allocation can fail, before anything has moved
+                    }
+                }
+            }
+
+            uninitialized_relocate_n_sequential(first, n, d_first);
+        }
+
+        // Moves n objects into uninitialized storage and ends the lifetime of the sources. Trivially relocatable
+        // objects are split across threads past parallel::threshold_bytes, others run their move constructors
+        // on the calling thread only. Ranges must not overlap.
+        template <typename T>
+        constexpr void uninitialized_relocate_n(T* first, std::size_t n, T* d_first) noexcept
+        {
+            uninitialized_relocate_n_split<is_trivially_relocatable_v<T>>(first, n, d_first);
+        }
+
+        // Splits any relocation, running T's move constructor on several threads
+        template <typename T>
+        constexpr void uninitialized_relocate_n(parallel::par_t, T* first, std::size_t n, T* d_first) noexcept
+        {
+            uninitialized_relocate_n_split<true>(first, n, d_first);
+        }
+
+        // Closes the gap of `count` destroyed objects at `first` by shifting [first + count, last) down.
+        // Leaves [last - count, last) as raw storage.
+        template <typename T>
+        constexpr void relocate_left(T* first, T* last, std::size_t count) noexcept
+        {
+            if constexpr (is_trivially_relocatable_v<T>)
+            {
+                if (!std::is_constant_evaluated())
+                {
+                    const auto tail{ static_cast<std::size_t>(last - first) - count };
+                    if (tail != 0)
+                    {
+                        std::memmove(static_cast<void*>(first), static_cast<const void*>(first + count), tail * sizeof(T));
+                    }
+
+                    return;
+                }
+            }
+
+            T* src{ first + count };
+            T* dst{ first };
+
+            for (; dst != first + count && src != last; ++dst, ++src)
+            {
+                std::construct_at(dst, std::move(*src));
+            }
+
+            for (; src != last; ++dst, ++src)
+            {
+                *dst = std::move(*src);
+            }
+
+            std::destroy(std::max(dst, first + count), last);
+        }
+
+        // Shifts [first, last) up by `count` into raw storage past `last`.
+        // Leaves [first, first + count) as raw storage.
+        template <typename T>
+        constexpr void relocate_right(T* first, T* last, std::size_t count) noexcept
+        {
+            if constexpr (is_trivially_relocatable_v<T>)
+            {
+                if (!std::is_constant_evaluated())
+                {
+                    if (first != last)
+                    {
+                        std::memmove(static_cast<void*>(first + count), static_cast<const void*>(first), static_cast<std::size_t>(last - first) * sizeof(T));
+                    }
+
+                    return;
+                }
+            }
+
+            T* src{ last };
+            T* dst{ last + count };
+
+            for (; src != first && dst != last; )
+            {
+                std::construct_at(--dst, std::move(*--src));
+            }
+
+            for (; src != first; )
+            {
+                *--dst = std::move(*--src);
+            }
+
+            std::destroy(first, std::min(first + count, last));
+        }
+
+        // Single pass compaction of [data, data + size), destroys every element matching pred and updates size.
+        // Basic guarantee if pred throws: size still covers only live elements.
+        template <typename T, typename Pred>
+        constexpr void relocate_remove_if(T* data, std::size_t& size, Pred& pred)
+        {
+            T* last{ data + size };
+            T* first{ std::find_if(data, last, pred) };
+            if (first == last) { return; }
+
+            if constexpr (is_trivially_relocatable_v<T>)
+            {
+                if (!std::is_constant_evaluated())
+                {
+                    T* dst{ first };
+                    T* src{ first };
+
+                    try
+                    {
+                        while (src != last) // *src is always a matching element here
+                        {
+                            std::destroy_at(src++);
+
+                            T* run{ src };
+                            while (run != last && !pred(*run)) { ++run; }
+
+                            const auto run_sz{ static_cast<std::size_t>(run - src) };
+                            if (run_sz != 0)
+                            {
+                                std::memmove(static_cast<void*>(dst), static_cast<const void*>(src), run_sz * sizeof(T));
+                            }
+
+                            dst += run_sz;
+                            src = run;
+                        }
+                    }
+                    catch (...)
+                    {
+                        std::memmove(static_cast<void*>(dst), static_cast<const void*>(src), static_cast<std::size_t>(last - src) * sizeof(T));
+                        size = static_cast<std::size_t>(dst - data) + static_cast<std::size_t>(last - src);
+                        throw;
+                    }
+
+                    size = static_cast<std::size_t>(dst - data);
+                    return;
+                }
+            }
+
+            T* new_last{ std::remove_if(first, last, pred) };
+            std::destroy(new_last, last);
+
+            size = static_cast<std::size_t>(new_last - data);
+        }
+
+        // Types whose == is equivalent to comparing object representations
+        template <typename T>
+        inline constexpr bool is_bitwise_comparable_v = std::is_integral_v<T> || std::is_enum_v<T> || std::is_pointer_v<T>;
+
+        // Types whose ordering matches memcmp's unsigned byte ordering
+        template <typename T>
+        inline constexpr bool is_bytewise_orderable_v = (sizeof(T) == 1 && std::is_unsigned_v<T>) || std::is_same_v<T, std::byte>;
+
+        template <typename T>
+        constexpr bool equal_n(const T* lhs, const T* rhs, std::size_t n)
+        {
+            if constexpr (is_bitwise_comparable_v<T>)
+            {
+                if (!std::is_constant_evaluated())
+                {
+                    return n == 0 || std::memcmp(lhs, rhs, n * sizeof(T)) == 0;
+                }
+            }
+
+            return std::equal(lhs, lhs + n, rhs);
+        }
+
+        template <typename T>
+        constexpr std::compare_three_way_result_t<T> compare_three_way_n(const T* lhs, const T* rhs, std::size_t n)
+        {
+            if constexpr (is_bytewise_orderable_v<T>)
+            {
+                if (!std::is_constant_evaluated())
+                {
+                    return (n == 0 ? 0 : std::memcmp(lhs, rhs, n)) <=> 0;
+                }
+            }
+            else if constexpr (is_bitwise_comparable_v<T>)
+            {
+                if (!std::is_constant_evaluated())
+                {
+                    // Skips equal blocks with memcmp, only the first differing block is compared element-wise
+                    constexpr std::size_t block{ std::max<std::size_t>(256 / sizeof(T), 1) };
+
+                    std::size_t skipped{};
+                    while (skipped + block <= n && std::memcmp(lhs + skipped, rhs + skipped, block * sizeof(T)) == 0)
+                    {
+                        skipped += block;
+                    }
+
+                    lhs += skipped;
+                    rhs += skipped;
+                    n -= skipped;
+                }
+            }
+
+            return std::lexicographical_compare_three_way(lhs, lhs + n, rhs, rhs + n);
+        }
+
+        // Pointer wrapper satisfying std::contiguous_iterator, ContiguousIterator<const T> is the const_iterator
+        template <typename T>
+        class ContiguousIterator
+        {
+        public:
+            using iterator_concept = std::contiguous_iterator_tag;
+            using iterator_category = std::random_access_iterator_tag;
+            using difference_type = std::ptrdiff_t;
+            using value_type = std::remove_cv_t<T>;
+            using pointer = T*;
+            using reference = T&;
+
+        public:
+            constexpr ContiguousIterator() noexcept
+                : mPtr{ nullptr }
+            { }
+
+            constexpr explicit ContiguousIterator(pointer ptr) noexcept
+                : mPtr{ ptr }
+            { }
+
+            template <typename U>
+                requires std::is_const_v<T> && std::same_as<U, std::remove_const_t<T>>
+            constexpr ContiguousIterator(ContiguousIterator<U> rhs) noexcept
+                : mPtr{ std::to_address(rhs) }
+            { }
+
+            constexpr pointer operator->() const noexcept { return mPtr; }
+            constexpr reference operator*() const noexcept { return *mPtr; }
+            constexpr reference operator[](difference_type index) const noexcept { return mPtr[index]; }
+
+            constexpr ContiguousIterator& operator++() noexcept
+            {
+                ++mPtr;
+                return *this;
+            }
+
+            constexpr ContiguousIterator operator++(int) noexcept
+            {
+                auto cp{ *this };
+                ++(*this);
+
+                return cp;
+            }
+
+            constexpr ContiguousIterator& operator--() noexcept
+            {
+                --mPtr;
+                return *this;
+            }
+
+            constexpr ContiguousIterator operator--(int) noexcept
+            {
+                auto cp{ *this };
+                --(*this);
+
+                return cp;
+            }
+
+            constexpr ContiguousIterator& operator+=(difference_type offset) noexcept
+            {
+                mPtr += offset;
+                return *this;
+            }
+
+            constexpr ContiguousIterator& operator-=(difference_type offset) noexcept
+            {
+                mPtr -= offset;
+                return *this;
+            }
+
+            friend constexpr bool operator==(ContiguousIterator lhs, ContiguousIterator rhs) noexcept { return lhs.mPtr == rhs.mPtr; }
+            friend constexpr std::strong_ordering operator<=>(ContiguousIterator lhs, ContiguousIterator rhs) noexcept { return lhs.mPtr <=> rhs.mPtr; }
+
+            friend constexpr ContiguousIterator operator+(ContiguousIterator it, difference_type n) noexcept { it += n; return it; }
+            friend constexpr ContiguousIterator operator-(ContiguousIterator it, difference_type n) noexcept { it -= n; return it; }
+            friend constexpr ContiguousIterator operator+(difference_type n, ContiguousIterator it) noexcept { return it + n; }
+            friend constexpr difference_type operator-(ContiguousIterator lhs, ContiguousIterator rhs) noexcept { return lhs.mPtr - rhs.mPtr; }
+
+        private:
+            pointer mPtr;
+        };
+
+        // Random access iterator going through Owner::operator[], for storage that isn't contiguous
+        template <typename Owner, typename T>
+        class IndexedIterator
+        {
+        public:
+            using iterator_concept = std::random_access_iterator_tag;
+            using iterator_category = std::random_access_iterator_tag;
+            using difference_type = std::ptrdiff_t;
+            using value_type = std::remove_cv_t<T>;
+            using pointer = T*;
+            using reference = T&;
+
+        public:
+            constexpr IndexedIterator() noexcept = default;
+
+            constexpr IndexedIterator(Owner* owner, std::size_t index) noexcept
+                : mOwner{ owner }
+                , mIndex{ index }
+            { }
+
+            template <typename O, typename U>
+                requires std::is_const_v<T> && std::same_as<U, std::remove_const_t<T>> && std::same_as<const O, Owner>
+            constexpr IndexedIterator(IndexedIterator<O, U> rhs) noexcept
+                : mOwner{ rhs.mOwner }
+                , mIndex{ rhs.mIndex }
+            { }
+
+            constexpr pointer operator->() const noexcept { return &(*mOwner)[mIndex]; }
+            constexpr reference operator*() const noexcept { return (*mOwner)[mIndex]; }
+            constexpr reference operator[](difference_type index) const noexcept { return (*mOwner)[mIndex + static_cast<std::size_t>(index)]; }
+
+            constexpr IndexedIterator& operator++() noexcept
+            {
+                ++mIndex;
+                return *this;
+            }
+
+            constexpr IndexedIterator operator++(int) noexcept
+            {
+                auto cp{ *this };
+                ++(*this);
+
+                return cp;
+            }
+
+            constexpr IndexedIterator& operator--() noexcept
+            {
+                --mIndex;
+                return *this;
+            }
+
+            constexpr IndexedIterator operator--(int) noexcept
+            {
+                auto cp{ *this };
+                --(*this);
+
+                return cp;
+            }
+
+            constexpr IndexedIterator& operator+=(difference_type offset) noexcept
+            {
+                mIndex += static_cast<std::size_t>(offset);
+                return *this;
+            }
+
+            constexpr IndexedIterator& operator-=(difference_type offset) noexcept
+            {
+                mIndex -= static_cast<std::size_t>(offset);
+                return *this;
+            }
+
+            friend constexpr bool operator==(IndexedIterator lhs, IndexedIterator rhs) noexcept { return lhs.mIndex == rhs.mIndex; }
+            friend constexpr std::strong_ordering operator<=>(IndexedIterator lhs, IndexedIterator rhs) noexcept { return lhs.mIndex <=> rhs.mIndex; }
+
+            friend constexpr IndexedIterator operator+(IndexedIterator it, difference_type n) noexcept { it += n; return it; }
+            friend constexpr IndexedIterator operator-(IndexedIterator it, difference_type n) noexcept { it -= n; return it; }
+            friend constexpr IndexedIterator operator+(difference_type n, IndexedIterator it) noexcept { return it + n; }
+            
+            friend constexpr difference_type operator-(IndexedIterator lhs, IndexedIterator rhs) noexcept 
+            { 
+                return static_cast<difference_type>(lhs.mIndex - rhs.mIndex); 
+            }
+
+        private:
+            template <typename O, typename U>
+            friend class IndexedIterator;
+
+            Owner* mOwner{};
+            std::size_t mIndex{};
+        };
+    } // namespace detail
+
+    namespace growth
+    {
+        // Every policy returns a capacity >= required
+        template <typename P>
+        concept policy = requires (std::size_t capacity, std::size_t required, std::size_t value_size)
+        {
+            { P::next_capacity(capacity, required, value_size) } noexcept -> std::same_as<std::size_t>;
+        };
+
+        // True when P or any policy it wraps is tracked, wrappers forward it so the nesting order doesn't matter
+        template <typename P>
+        inline constexpr bool tracks_stats_v{ requires { requires P::tracks_stats; } };
+
+        struct doubling
+        {
+            static constexpr std::size_t next_capacity(std::size_t capacity, std::size_t required, std::size_t) noexcept
+            {
+                const auto grown{ capacity > std::numeric_limits<std::size_t>::max() / 2 ? required : capacity * 2 };
+                return std::max({ grown, required, std::size_t{ 1 } });
+            }
+        };
+
+        // 1.5x: the sum of previously freed blocks eventually fits the next request, so the allocator can reuse them
+        struct one_and_half
+        {
+            static constexpr std::size_t next_capacity(std::size_t capacity, std::size_t required, std::size_t) noexcept
+            {
+                const auto grown{ capacity > std::numeric_limits<std::size_t>::max() / 3 * 2 ? required : capacity + capacity / 2 };
+                return std::max({ grown, required, std::size_t{ 2 } });
+            }
+        };
+
+        template <std::size_t Increment>
+            requires (Increment > 0)
+        struct fixed_increment
+        {
+            static constexpr std::size_t next_capacity(std::size_t capacity, std::size_t required, std::size_t) noexcept
+            {
+                if (required <= capacity) { return capacity; }
+
+                const auto steps{ (required - capacity + Increment - 1) / Increment };
+                return capacity + steps * Increment;
+            }
+        };
+
+        // Grows like Base and gives memory back once the size falls below capacity / Divisor, shrinking to twice
+        // the size. The gap between both thresholds keeps alternating push/pop from reallocating every time.
+        template <policy Base = doubling, std::size_t Divisor = 4>
+            requires (Divisor > 2)
+        struct trimming
+        {
+            static constexpr bool tracks_stats{ tracks_stats_v<Base> };
+
+            static constexpr std::size_t next_capacity(std::size_t capacity, std::size_t required, std::size_t value_size) noexcept
+            {
+                return Base::next_capacity(capacity, required, value_size);
+            }
+
+            static constexpr std::size_t trimmed_capacity(std::size_t capacity, std::size_t size, std::size_t) noexcept
+            {
+                return size < capacity / Divisor ? size * 2 : capacity;
+            }
+        };
+
+        // Grows like Base and makes the vector keep allocation statistics, see vector::stats() and stats::global()
+        template <policy Base = doubling>
+        struct tracked
+        {
+            static constexpr bool tracks_stats{ true };
+
+            static constexpr std::size_t next_capacity(std::size_t capacity, std::size_t required, std::size_t value_size) noexcept
+            {
+                return Base::next_capacity(capacity, required, value_size);
+            }
+
+            static constexpr std::size_t trimmed_capacity(std::size_t capacity, std::size_t size, std::size_t value_size) noexcept
+                requires requires { Base::trimmed_capacity(std::size_t{}, std::size_t{}, std::size_t{}); }
+            {
+                return Base::trimmed_capacity(capacity, size, value_size);
+            }
+        };
+
+        // Rounds the result of Base up so the block fills whole pages
+        template <policy Base = doubling, std::size_t PageSize = 4096>
+        struct page_rounded
+        {
+            static constexpr bool tracks_stats{ tracks_stats_v<Base> };
+
+            static constexpr std::size_t next_capacity(std::size_t capacity, std::size_t required, std::size_t value_size) noexcept
+            {
+                const auto cap{ Base::next_capacity(capacity, required, value_size) };
+                if (value_size == 0 || value_size > PageSize || cap > std::numeric_limits<std::size_t>::max() / value_size - PageSize) 
+                { 
+                    return cap; 
+                }
+
+                const auto bytes{ (cap * value_size + PageSize - 1) / PageSize * PageSize };
+                return bytes / value_size;
+            }
+        };
+    } // namespace growth
+
+    template <typename T, 
+              typename Alloc = std::allocator<T>, 
+              growth::policy GrowthPolicy = growth::doubling, 
+              typename Buffer = detail::Buffer<T, Alloc>>
+        requires std::is_nothrow_move_assignable_v<T> &&
+                 std::is_nothrow_move_constructible_v<T>
+    class vector
+    {
+    public:
+        using value_type = T;
+        using allocator_type = Alloc;
+        using growth_policy = GrowthPolicy;
+        using size_type = std::size_t;
+        using difference_type = std::ptrdiff_t;
+        using reference = value_type&;
+        using const_reference = const value_type&;
+        using pointer = typename std::allocator_traits<Alloc>::pointer;
+        using const_pointer = typename std::allocator_traits<Alloc>::const_pointer;
+        using iterator = detail::ContiguousIterator<T>;
+        using const_iterator = detail::ContiguousIterator<const T>;
+
+        using buffer_t = Buffer;
+        using alloc_traits = std::allocator_traits<Alloc>;
+
+        // Inline buffers can't hand over their storage, moves and swaps relocate the live elements instead
+        static constexpr bool has_inline_storage{ buffer_t::inline_capacity != 0 };
+        static constexpr bool tracks_stats{ growth::tracks_stats_v<GrowthPolicy> };
+
+        // Writes straight into reserved storage and publishes the new size once, when it goes out of scope.
+        // The vector must not be used until then.
+        class append_cursor
+        {
+        public:
+            append_cursor(const append_cursor&) = delete;
+            append_cursor& operator=(const append_cursor&) = delete;
+
+            // Nothrow
+            constexpr ~append_cursor() noexcept
+            {
+                mVector.mSize = static_cast<size_type>(mPos - mVector.mBuffer.data());
+            }
+
+            // Strong. Requires remaining() != 0
+            template <typename... Args>
+            constexpr reference emplace_back(Args&&... args)
+            {
+                T* location{ std::construct_at(mPos, std::forward<Args>(args)...) };
+                ++mPos;
+
+                return *location;
+            }
+
+            // Strong. Requires remaining() != 0
+            constexpr void push_back(const T& value) { emplace_back(value); }
+            constexpr void push_back(T&& value) { emplace_back(std::move(value)); }
+
+            // Nothrow
+            constexpr size_type remaining() const noexcept { return static_cast<size_type>(mEnd - mPos); }
+
+        private:
+            friend class vector;
+
+            constexpr explicit append_cursor(vector& vec) noexcept
+                : mVector{ vec }
+                , mPos{ vec.mBuffer.data(vec.mSize) }
+                , mEnd{ vec.mBuffer.data(vec.capacity()) }
+            { }
+
+            vector& mVector;
+            T* mPos;
+            T* mEnd;
+        };
+
+    public:
+        // Nothrow
+        constexpr vector() = default;
+
+        // Nothrow if alloc nothrow
+        constexpr vector(const Alloc& alloc)
+            : mBuffer{ alloc }
+            , mSize{}
+        { }
+
+        // Strong 
+        constexpr vector(std::size_t capacity, const Alloc& alloc = Alloc{})
+            : mBuffer{ capacity, alloc }
+            , mSize{}
+        {
+            record_allocation();
+        }
+
+        // Strong
+        constexpr vector(std::initializer_list<T> list, const Alloc& alloc = Alloc{}) 
+            : mBuffer{ std::size(list), alloc }
+            , mSize{}
+        {
+            record_allocation();
+            const auto sz{ std::size(list) };
+
+            detail::uninitialized_copy_n(std::begin(list), sz, std::data(mBuffer));
+            mSize = sz;
+        }
+
+        // Strong, allocates once for forward iterators
+        template <std::input_iterator It>
+        constexpr vector(It first, It last, const Alloc& alloc = Alloc{})
+            : vector(alloc)
+        {
+            append_range(std::ranges::subrange(std::move(first), std::move(last)));
+        }
+
+        // Strong, allocates once for forward and sized ranges
+        template <std::ranges::input_range R>
+            requires std::convertible_to<std::ranges::range_reference_t<R>, T>
+        constexpr vector(from_range_t, R&& rg, const Alloc& alloc = Alloc{})
+            : vector(alloc)
+        {
+            append_range(std::forward<R>(rg));
+        }
+
+        // Strong
+        constexpr vector(const vector& rhs)
+            : mBuffer{ rhs.mBuffer }
+            , mSize{}
+        {
+            record_allocation();
+            detail::uninitialized_copy_n(std::data(rhs.mBuffer), rhs.mSize, std::data(mBuffer));
+            mSize = rhs.mSize;
+        }
+
+        // Strong, copies in parallel past parallel::threshold_bytes
+        constexpr vector(parallel::par_t, const vector& rhs)
+            : mBuffer{ rhs.mBuffer }
+            , mSize{}
+        {
+            record_allocation();
+            detail::uninitialized_copy_n(parallel::par, std::data(rhs.mBuffer), rhs.mSize, std::data(mBuffer));
+            mSize = rhs.mSize;
+        }
+
+        // Strong
+        constexpr vector(const vector& rhs, const Alloc& alloc)
+            : mBuffer{ rhs.capacity(), alloc }
+            , mSize{}
+        {
+            record_allocation();
+            detail::uninitialized_copy_n(std::data(rhs.mBuffer), rhs.mSize, std::data(mBuffer));
+            mSize = rhs.mSize;
+        }
+
+        // Nothrow
+        constexpr vector(vector&& rhs) noexcept
+            : mBuffer{ take_buffer(rhs) }
+            , mSize{ std::exchange(rhs.mSize, 0) }
+        { }
+
+        // Strong, nothrow if alloc == rhs.get_allocator()
+        constexpr vector(vector&& rhs, const Alloc& alloc)
+            : mBuffer{ alloc }
+            , mSize{}
+        {
+            if (mBuffer.get_allocator() == rhs.mBuffer.get_allocator())
+            {
+                swap(*this, rhs);
+            }
+            else 
+            {
+                vector copy(rhs.mSize, alloc);
+                copy.relocate_from(rhs);
+                adopt(copy);
+            }
+        }
+
+        // Strong
+        constexpr vector& operator=(const vector& rhs)
+        {
+            if (this != &rhs)
+            {
+                constexpr bool propagate{ alloc_traits::propagate_on_container_copy_assignment::value };
+
+                vector copy(rhs, propagate ? rhs.get_allocator() : get_allocator());
+                adopt(copy);
+
+                if constexpr (propagate && !alloc_traits::propagate_on_container_swap::value)
+                {
+                    using std::swap;
+                    swap(mBuffer.get_allocator(), copy.mBuffer.get_allocator());
+                }
+            }
+
+            return *this;
+        }
+
+        // Nothrow if the allocator propagates or is always equal, strong otherwise
+        constexpr vector& operator=(vector&& rhs) noexcept(alloc_traits::propagate_on_container_move_assignment::value || 
+                                                           alloc_traits::is_always_equal::value) // *
+        {
+            if (this != &rhs)
+            {
+                if constexpr (!alloc_traits::propagate_on_container_move_assignment::value && 
+                              !alloc_traits::is_always_equal::value)
+                {
+                    if (mBuffer.get_allocator() != rhs.mBuffer.get_allocator())
+                    {
+                        vector copy(rhs.mSize, mBuffer.get_allocator());
+                        copy.relocate_from(rhs);
+                        adopt(copy);
+
+                        return *this;
+                    }
+                }
+
+                std::destroy_n(std::data(mBuffer), mSize);
+
+                if constexpr (has_inline_storage) { mBuffer.assign(std::move(rhs.mBuffer), rhs.mSize); }
+                else { mBuffer = std::move(rhs.mBuffer); }
+
+                mSize = std::exchange(rhs.mSize, 0);
+            }
+
+            return *this;
+        }
+
+        // Basic if the new contents fit into the current capacity, strong otherwise
+        constexpr void assign(size_type count, const T& value)
+        {
+            if (count > capacity())
+            {
+                vector copy(count, get_allocator());
+                copy.resize(count, value);
+                adopt(copy);
+
+                return;
+            }
+
+            T tmp(value);
+            std::destroy_n(std::data(mBuffer), std::exchange(mSize, 0));
+            detail::uninitialized_construct_with_args_n(count, std::data(mBuffer), tmp);
+            mSize = count;
+        }
+
+        // Basic if the new contents fit into the current capacity, strong otherwise
+        template <std::input_iterator It>
+        constexpr void assign(It first, It last)
+        {
+            assign_range(std::ranges::subrange(std::move(first), std::move(last)));
+        }
+
+        // Basic if the new contents fit into the current capacity, strong otherwise
+        constexpr void assign(std::initializer_list<T> list)
+        {
+            assign_range(list);
+        }
+
+        // Basic if the new contents fit into the current capacity, strong otherwise.
+        // rg must not refer to this vector's elements.
+        template <std::ranges::input_range R>
+            requires std::convertible_to<std::ranges::range_reference_t<R>, T>
+        constexpr void assign_range(R&& rg)
+        {
+            if constexpr (std::ranges::forward_range<R> || std::ranges::sized_range<R>)
+            {
+                const auto count{ static_cast<size_type>(std::ranges::distance(rg)) };
+
+                if (count <= capacity())
+                {
+                    std::destroy_n(std::data(mBuffer), std::exchange(mSize, 0));
+                    detail::uninitialized_copy_n(std::ranges::begin(rg), count, std::data(mBuffer));
+                    mSize = count;
+
+                    return;
+                }
+            }
+
+            vector copy(get_allocator());
+            copy.append_range(std::forward<R>(rg));
+            adopt(copy);
+        }
+
+        // Nothrow
+        constexpr ~vector() noexcept 
+        {
+            std::destroy_n(std::data(mBuffer), mSize);
+        }
+
+        // Nothrow
+        constexpr allocator_type get_allocator() const noexcept { return mBuffer.get_allocator(); }
+
         // Nothrow
         constexpr size_type size() const noexcept { return mSize; }
         constexpr size_type capacity() const noexcept { return mBuffer.capacity(); }
         
         // Strong
-        constexpr reference operator[](std::size_t index) { return *mBuffer.data(index); }
-        constexpr const_reference operator[](std::size_t index) const { return *mBuffer.data(index); }
+        constexpr reference operator[](std::size_t index) { return *mBuffer.data(index); }
+        constexpr const_reference operator[](std::size_t index) const { return *mBuffer.data(index); }
+
+        // Nothrow
+        constexpr pointer data() noexcept { return mBuffer.data(); };
+        constexpr const_pointer data() const noexcept { return mBuffer.data(); }
+
+        // Nothrow
+        constexpr bool empty() const noexcept { return mSize == 0; }
+
+        // Strong
+        constexpr void reserve(size_type capacity)
+        {
+            if (mBuffer.capacity() >= capacity || try_reallocate(capacity)) { return; }
+
+            vector copy(capacity, *this);
+            adopt_reallocated(copy, std::size(copy));
+        }
+
+        // Strong. Unless the block grows in place, the elements move to a new block on several threads past
+        // parallel::threshold_bytes, bypassing realloc/mremap. T's move constructor may run concurrently.
+        constexpr void reserve(parallel::par_t, size_type capacity)
+        {
+            const auto old_capacity{ this->capacity() };
+            if (old_capacity >= capacity) { return; }
+
+            if (mBuffer.try_expand(capacity))
+            {
+                record_reallocation(old_capacity, 0);
+                return;
+            }
+
+            vector copy(capacity, get_allocator());
+            copy.relocate_from(parallel::par, *this);
+
+            adopt_reallocated(copy, std::size(copy));
+        }
+
+        // Strong, non-binding: the capacity may stay above size() when the storage can't shrink further
+        constexpr void shrink_to_fit()
+        {
+            shrink_to(mSize);
+        }
+
+        // Nothrow, keeps the capacity unless the growth policy trims it
+        constexpr void clear() noexcept
+        {
+            std::destroy_n(mBuffer.data(), mSize);
+            mSize = 0;
+
+            trim();
+        }
+
+        // Nothrow, page mapped blocks return the pages past size() to the OS without moving or shrinking
+        constexpr void release_unused_pages() noexcept
+        {
+            mBuffer.release_unused(mSize);
+        }
+
+        // Nothrow, what this object allocated and relocated since it was constructed. Moves and swaps hand
+        // over blocks but not their history.
+        constexpr const vectorx::stats::counters& stats() const noexcept
+            requires tracks_stats
+        {
+            return mStats;
+        }
+
+        // Strong
+        constexpr void push_back(const T& value)
+        {
+            emplace_back(value);
+        }
+
+        // Strong
+        constexpr void push_back(T&& value)
+        {
+            emplace_back(std::move(value));
+        }
+
+        // Strong
+        template <typename... Args>
+        constexpr reference emplace_back(Args&&... args)
+        {
+            if (capacity() == mSize)
+            {
+                grow_and_emplace(next_capacity(mSize + 1), std::forward<Args>(args)...);
+            }
+            else 
+            {
+                std::construct_at(mBuffer.data(mSize), std::forward<Args>(args)... );
+            }
+            
+            ++mSize;
+            return *mBuffer.data(mSize - 1);
+        }
+
+        // Strong. Requires size() < capacity()
+        constexpr void push_back_unchecked(const T& value)
+        {
+            emplace_back_unchecked(value);
+        }
+
+        // Strong. Requires size() < capacity()
+        constexpr void push_back_unchecked(T&& value)
+        {
+            emplace_back_unchecked(std::move(value));
+        }
+
+        // Strong. Requires size() < capacity(), never reallocates
+        template <typename... Args>
+        constexpr reference emplace_back_unchecked(Args&&... args)
+        {
+            T* location{ std::construct_at(mBuffer.data(mSize), std::forward<Args>(args)...) };
+            ++mSize;
+
+            return *location;
+        }
+
+        // Strong. Makes room for `count` more elements and returns a cursor appending into it
+        [[nodiscard]] constexpr append_cursor begin_append(size_type count)
+        {
+            if (capacity() - mSize < count)
+            {
+                reserve(next_capacity(mSize + count));
+            }
+
+            return append_cursor{ *this };
+        }
+
+        // Strong
+        constexpr void resize(std::size_t new_sz)
+        {
+            resize_with(new_sz);
+        }
+
+        // Strong
+        constexpr void resize(std::size_t new_sz, const value_type& init_value)
+        {
+            resize_with(new_sz, init_value);
+        }
 
-        // Nothrow
-        constexpr pointer data() noexcept { return mBuffer.data(); };
-        constexpr const_pointer data() const noexcept { return mBuffer.data(); }
+        // Strong, fills in parallel past parallel::threshold_bytes
+        constexpr void resize(parallel::par_t, std::size_t new_sz, const value_type& init_value)
+        {
+            if (new_sz <= mSize)
+            {
+                resize_with(new_sz, init_value);
+                return;
+            }
 
-        // Nothrow
-        constexpr bool empty() const noexcept { return mSize == 0; }
+            const size_type old_size{ mSize };
+            if (new_sz <= capacity())
+            {
+                detail::uninitialized_construct_with_args_n(parallel::par, new_sz - old_size, mBuffer.data(old_size), init_value);
+                mSize = new_sz;
+
+                return;
+            }
+
+            // Fill before relocating, init_value may be one of our elements
+            vector copy(next_capacity(new_sz), get_allocator());
+            detail::uninitialized_construct_with_args_n(parallel::par, new_sz - old_size, copy.mBuffer.data(old_size), init_value);
+
+            copy.relocate_from(*this);
+            copy.mSize = new_sz;
+
+            adopt_reallocated(copy, old_size);
+        }
+
+        // Strong. New elements are default-initialized: trivial ones are left for the caller to overwrite
+        constexpr void resize_for_overwrite(std::size_t new_sz)
+        {
+            resize_with(new_sz, detail::default_init);
+        }
+
+        friend constexpr bool operator==(const vector& lhs, const vector& rhs) noexcept
+        {
+            return lhs.mSize == rhs.mSize && detail::equal_n(lhs.mBuffer.data(), rhs.mBuffer.data(), lhs.mSize);
+        }
+
+        friend constexpr auto operator<=>(const vector& lhs, const vector& rhs)
+            requires std::three_way_comparable<T>
+        {
+            const auto common{ std::min(lhs.mSize, rhs.mSize) };
+
+            if (const auto cmp{ detail::compare_three_way_n(lhs.mBuffer.data(), rhs.mBuffer.data(), common) }; cmp != 0)
+            {
+                return cmp;
+            }
+
+            return std::compare_three_way_result_t<T>{ lhs.mSize <=> rhs.mSize };
+        }
+
+        friend constexpr bool operator!=(const vector& lhs, const vector& rhs) noexcept
+        {
+            return !(lhs == rhs);
+        }
+
+        friend void swap(vector& lhs, vector& rhs) noexcept
+        {
+            using std::swap;
+
+            if constexpr (has_inline_storage) { buffer_t::swap(lhs.mBuffer, lhs.mSize, rhs.mBuffer, rhs.mSize); }
+            else { swap(lhs.mBuffer, rhs.mBuffer); }
+
+            swap(lhs.mSize, rhs.mSize);
+        }
+
+        constexpr iterator begin() noexcept { return iterator{ std::data(mBuffer) }; }
+        constexpr const_iterator begin() const noexcept { return const_iterator{ std::data(mBuffer) }; }
+        constexpr const_iterator cbegin() const noexcept { return begin(); }
+        
+        constexpr iterator end() noexcept { return iterator{ mBuffer.data(mSize) }; }
+        constexpr const_iterator end() const noexcept { return const_iterator{ mBuffer.data(mSize) }; }
+        constexpr const_iterator cend() const noexcept { return end(); }
 
         // Strong
-        constexpr void reserve(size_type capacity)
+        template <typename... Args>
+        constexpr iterator emplace(const_iterator pos, Args&&... args)
         {
-            if (mBuffer.capacity() >= capacity) { return; }
+            const auto pos_idx{ index_of(pos) };
 
-            vector copy(capacity, *this);
-            swap(*this, copy);
+            if (pos_idx == mSize)
+            {
+                emplace_back(std::forward<Args>(args)...);
+            }
+            else if (mSize < capacity())
+            {
+                T value(std::forward<Args>(args)...); // args may refer to an element
+                
+                detail::relocate_right(mBuffer.data(pos_idx), mBuffer.data(mSize), 1);
+                std::construct_at(mBuffer.data(pos_idx), std::move(value));
+                
+                ++mSize;
+            }
+            else 
+            {
+                vector copy(next_capacity(mSize + 1), get_allocator());
+                
+                std::construct_at(copy.mBuffer.data(pos_idx), std::forward<Args>(args)...);
+                copy.relocate_around(*this, pos_idx, 1);
+                
+                adopt_reallocated(copy, std::size(copy) - 1);
+            }
+
+            return iterator{ mBuffer.data(pos_idx) };
         }
 
         // Strong
-        constexpr void push_back(const T& value)
+        constexpr iterator insert(const_iterator pos, const T& value)
         {
-            emplace_back(value);
+            return emplace(pos, value);
         }
 
         // Strong
-        constexpr void push_back(T&& value)
+        constexpr iterator insert(const_iterator pos, size_type n, const T& value)
         {
-            emplace_back(std::move(value));
+            const T copy_value(value); // value may refer to an element
+            
+            return insert_with(index_of(pos), n, [&](T* location) 
+            { 
+                detail::uninitialized_construct_with_args_n(n, location, copy_value); 
+            });
         }
 
         // Strong
-        template <typename... Args>
-        constexpr reference emplace_back(Args&&... args)
+        template <std::input_iterator It>
+        constexpr iterator insert(const_iterator pos, It first, It last)
         {
-            if (auto cap{ capacity() }; cap == mSize)
+            if constexpr (std::forward_iterator<It>)
             {
-                cap = (cap == 0 ? 1 : cap * 2);
-
-                vector copy(cap); 
-                copy.construct_and_swap(*this, std::forward<Args>(args)...);
+                return insert_counted(index_of(pos), first, static_cast<size_type>(std::distance(first, last)));
             }
             else 
             {
-                std::construct_at(mBuffer.data(mSize), std::forward<Args>(args)... );
+                vector tmp(get_allocator());
+                for (; first != last; ++first)
+                {
+                    tmp.emplace_back(*first);
+                }
+
+                return insert_counted(index_of(pos), std::make_move_iterator(tmp.begin()), std::size(tmp));
             }
-            
-            ++mSize;
-            return *mBuffer.data(mSize - 1);
         }
 
         // Strong
-        constexpr void resize(std::size_t new_sz)
+        constexpr iterator insert(const_iterator pos, std::initializer_list<T> list)
         {
-            if (new_sz == mSize) { return; }
+            return insert_counted(index_of(pos), std::begin(list), std::size(list));
+        }
 
-            if (new_sz < mSize)
+        // Strong
+        template <std::ranges::input_range R>
+            requires std::convertible_to<std::ranges::range_reference_t<R>, T>
+        constexpr iterator insert_range(const_iterator pos, R&& rg)
+        {
+            if constexpr (std::ranges::forward_range<R> || std::ranges::sized_range<R>)
             {
-                std::destroy_n(mBuffer.data(new_sz), mSize - new_sz);
+                return insert_counted(index_of(pos), std::ranges::begin(rg), static_cast<size_type>(std::ranges::distance(rg)));
             }
             else 
             {
-                vector copy(new_sz * 2);
-                copy.construct_and_swap_n(*this, new_sz - mSize);
+                vector tmp(get_allocator());
+                for (auto&& el : rg)
+                {
+                    tmp.emplace_back(std::forward<decltype(el)>(el));
+                }
+
+                return insert_counted(index_of(pos), std::make_move_iterator(tmp.begin()), std::size(tmp));
+            }
+        }
+
+        // Strong, allocates at most once for forward and sized ranges
+        template <std::ranges::input_range R>
+            requires std::convertible_to<std::ranges::range_reference_t<R>, T>
+        constexpr void append_range(R&& rg)
+        {
+            if constexpr (std::ranges::forward_range<R> || std::ranges::sized_range<R>)
+            {
+                insert_counted(mSize, std::ranges::begin(rg), static_cast<size_type>(std::ranges::distance(rg)));
             }
+            else 
+            {
+                const size_type old_size{ mSize };
 
-            mSize = new_sz;
+                try 
+                {
+                    for (auto&& el : rg)
+                    {
+                        emplace_back(std::forward<decltype(el)>(el));
+                    }
+                }
+                catch (...)
+                {
+                    std::destroy(mBuffer.data(old_size), mBuffer.data(mSize));
+                    mSize = old_size;
+                    throw;
+                }
+            }
+        }
+
+        // Nothrow
+        constexpr iterator erase(const_iterator pos) noexcept
+        {
+            std::size_t pos_idx{ index_of(pos) };
+            pos_idx = (pos_idx == mSize ? mSize - 1 : pos_idx); // end() drops the last element
+
+            std::destroy_at(mBuffer.data(pos_idx));
+            detail::relocate_left(mBuffer.data(pos_idx), mBuffer.data(mSize), 1);
+            
+            --mSize;
+            trim();
+
+            return iterator{ mBuffer.data(pos_idx) };
+        }
+
+        // Nothrow
+        constexpr iterator erase(const_iterator first, const_iterator last) noexcept
+        {
+            const auto first_idx{ index_of(first) };
+            const auto count{ index_of(last) - first_idx };
+
+            if (count != 0)
+            {
+                std::destroy_n(mBuffer.data(first_idx), count);
+                detail::relocate_left(mBuffer.data(first_idx), mBuffer.data(mSize), count);
+
+                mSize -= count;
+                trim();
+            }
+
+            return iterator{ mBuffer.data(first_idx) };
+        }
+
+        // Keeps the elements satisfying pred, returns the number of erased elements
+        template <typename Pred>
+        constexpr size_type retain(Pred pred)
+        {
+            return remove_if([&pred](const T& el) { return !pred(el); });
+        }
+
+    private:
+        constexpr vector(std::size_t capacity, vector& rhs)
+            : mBuffer{ capacity, rhs.mBuffer.get_allocator() }
+            , mSize{}
+        {
+            record_allocation();
+            relocate_from(rhs);
         }
 
         // Strong
-        constexpr void resize(std::size_t new_sz, const value_type& init_value)
+        template <typename... Args>
+        constexpr void resize_with(size_type new_sz, const Args&... args)
         {
             if (new_sz == mSize) { return; }
 
             if (new_sz < mSize)
             {
                 std::destroy_n(mBuffer.data(new_sz), mSize - new_sz);
+                mSize = new_sz;
+
+                trim();
+                return;
+            }
+            else if (new_sz <= capacity())
+            {
+                detail::uninitialized_construct_with_args_n(new_sz - mSize, mBuffer.data(mSize), args...);
             }
             else 
             {
-                vector copy(new_sz * 2);
-                copy.construct_and_swap_n(*this, new_sz - mSize, init_value);
+                grow_and_construct_n(next_capacity(new_sz), new_sz - mSize, args...);
             }
 
             mSize = new_sz;
         }
 
-        friend bool operator==(const vector& lhs, const vector& rhs) noexcept
+        template <typename Pred>
+        constexpr size_type remove_if(Pred&& pred)
         {
-            return std::equal(std::data(lhs), std::data(lhs) + std::size(lhs), std::data(rhs));
+            const auto old_sz{ mSize };
+            detail::relocate_remove_if(mBuffer.data(), mSize, pred);
+            trim();
+
+            return old_sz - mSize;
         }
 
-        friend bool operator!=(const vector& lhs, const vector& rhs) noexcept
+        // Strong, capacity ends up at least max(capacity, inline capacity)
+        constexpr void shrink_to(size_type capacity)
         {
-            return !(lhs == rhs);
+            capacity = std::max(capacity, buffer_t::inline_capacity);
+            if (capacity >= this->capacity()) { return; }
+
+            if constexpr (buffer_t::is_reallocatable)
+            {
+                if (!std::is_constant_evaluated())
+                {
+                    const auto old_capacity{ this->capacity() };
+                    const T* old_data{ mBuffer.data() };
+                    
+                    mBuffer.shrink(capacity);
+                    if (this->capacity() != old_capacity) // a failed remap or realloc keeps the block as it was
+                    {
+                        record_reallocation(old_capacity, old_data == mBuffer.data() ? 0 : mSize);
+                    }
+                    
+                    return;
+                }
+            }
+
+            vector copy(capacity, *this);
+            adopt_reallocated(copy, std::size(copy));
         }
 
-        friend void swap(vector& lhs, vector& rhs) noexcept
+        // Nothrow, best effort: keeping the capacity is always valid, so a failed shrink is dropped
+        constexpr void trim() noexcept
         {
-            using std::swap;
+            if constexpr (requires { GrowthPolicy::trimmed_capacity(std::size_t{}, std::size_t{}, std::size_t{}); })
+            {
+                const size_type capacity{ GrowthPolicy::trimmed_capacity(this->capacity(), mSize, sizeof(T)) };
+                if (capacity >= this->capacity()) { return; }
 
-            swap(lhs.mSize, rhs.mSize);
-            swap(lhs.mBuffer, rhs.mBuffer);
+                try 
+                {
+                    shrink_to(capacity);
+                }
+                catch (...)
+                {
+                }
+            }
         }
 
-        constexpr iterator begin() { return iterator{ std::data(mBuffer) }; }
-        constexpr const_iterator cbegin() const { return iterator{ std::data(mBuffer) }; }
-        
-        constexpr iterator end() { return iterator{ mBuffer.data(mSize) }; }
-        constexpr const_iterator cend() const { return iterator{ mBuffer.data(mSize) }; }
+        // Nothrow
+        constexpr size_type index_of(const_iterator pos) const noexcept
+        {
+            return static_cast<size_type>(std::to_address(pos) - mBuffer.data());
+        }
 
-        // Strong
-        constexpr iterator insert(const_iterator pos, const T& value)
+        // Strong, `construct(location)` builds `count` elements at location or leaves it untouched on throw
+        template <typename Construct>
+        constexpr iterator insert_with(size_type pos_idx, size_type count, Construct&& construct)
         {
-            auto cap{ capacity() };
-            cap = (cap < mSize + 1 ? mSize + 1 : cap);
+            if (count == 0) { return iterator{ mBuffer.data(pos_idx) }; }
 
-            vector copy(cap);
-            auto pos_idx{ std::distance(begin(), pos) };
+            if (mSize + count <= capacity())
+            {
+                detail::relocate_right(mBuffer.data(pos_idx), mBuffer.data(mSize), count);
 
-            std::construct_at(copy.mBuffer.data(pos_idx), value);
-            std::uninitialized_move_n(std::data(mBuffer), pos_idx, std::data(copy.mBuffer));
-            std::uninitialized_move_n(mBuffer.data(pos_idx), mSize - pos_idx, copy.mBuffer.data(pos_idx + 1));
-            
-            copy.mSize = mSize + 1;
+                try
+                {
+                    construct(mBuffer.data(pos_idx));
+                }
+                catch (...)
+                {
+                    detail::relocate_left(mBuffer.data(pos_idx), mBuffer.data(mSize + count), count);
+                    throw;
+                }
+
+                mSize += count;
+            }
+            else 
+            {
+                vector copy(next_capacity(mSize + count), get_allocator());
+                
+                construct(copy.mBuffer.data(pos_idx));
+                copy.relocate_around(*this, pos_idx, count);
+
+                adopt_reallocated(copy, std::size(copy) - count);
+            }
 
-            swap(*this, copy);
             return iterator{ mBuffer.data(pos_idx) };
         }
 
-        // Nothrow
-        constexpr iterator erase(const_iterator pos) noexcept
+        // Strong
+        template <typename It>
+        constexpr iterator insert_counted(size_type pos_idx, It first, size_type count)
         {
-            std::ptrdiff_t pos_idx{ std::distance(begin(), pos) };
-            std::destroy_at(mBuffer.data(pos_idx));
+            return insert_with(pos_idx, count, [&](T* location) 
+            { 
+                detail::uninitialized_copy_n(first, count, location);
+            });
+        }
 
-            for (std::ptrdiff_t i{ pos_idx }; i < static_cast<std::ptrdiff_t>(mSize) - 1; ++i)
-            {
-                *mBuffer.data(i) = std::move(*mBuffer.data(i + 1));
-            }
+        // Nothrow, moves other's elements around `count` already constructed elements at pos_idx
+        constexpr void relocate_around(vector& other, size_type pos_idx, size_type count) noexcept
+        {
+            detail::uninitialized_relocate_n(std::data(other.mBuffer), pos_idx, std::data(mBuffer));
+            detail::uninitialized_relocate_n(other.mBuffer.data(pos_idx), other.mSize - pos_idx, mBuffer.data(pos_idx + count));
 
-            auto* ptr{ pos_idx == static_cast<std::ptrdiff_t>(mSize) ? mBuffer.data(mSize - 1) : mBuffer.data(pos_idx) };
-            --mSize;
+            mSize = std::exchange(other.mSize, 0) + count;
+        }
 
-            return iterator{ ptr };
+        // Nothrow
+        constexpr size_type next_capacity(size_type required) const noexcept
+        {
+            return GrowthPolicy::next_capacity(capacity(), required, sizeof(T));
         }
 
-    private:
-        constexpr vector(std::size_t capacity, vector& rhs)
-            : mBuffer{ capacity } // move alloc or not ?
-            , mSize{ std::size(rhs) }
+        // Nothrow
+        static constexpr buffer_t take_buffer(vector& rhs) noexcept
+        {
+            if constexpr (has_inline_storage) { return buffer_t{ std::move(rhs.mBuffer), rhs.mSize }; }
+            else { return std::move(rhs.mBuffer); }
+        }
+
+        // Nothrow
+        constexpr void relocate_from(vector& other) noexcept
+        {
+            detail::uninitialized_relocate_n(std::data(other.mBuffer), other.mSize, std::data(mBuffer));
+            mSize = std::exchange(other.mSize, 0);
+        }
+
+        // Nothrow
+        constexpr void relocate_from(parallel::par_t, vector& other) noexcept
         {
-            std::uninitialized_move_n(std::data(rhs.mBuffer), std::size(rhs), std::data(mBuffer));
+            detail::uninitialized_relocate_n(parallel::par, std::data(other.mBuffer), other.mSize, std::data(mBuffer));
+            mSize = std::exchange(other.mSize, 0);
         }
 
         template <typename... Args> 
-            requires (sizeof...(Args) >= 1) 
         constexpr void construct_and_swap(vector& other, Args&&... args)
         {
-            const auto sz{ std::size(other) };
+            std::construct_at(mBuffer.data(std::size(other)), std::forward<Args>(args)...);
+            
+            relocate_from(other);
+            other.adopt_reallocated(*this, mSize);
+        }
 
-            std::construct_at(mBuffer.data(sz), std::forward<Args>(args)...);
-            std::uninitialized_move_n(std::data(other.mBuffer), sz, std::data(mBuffer));
-    
-            mSize = other.mSize;
-            swap(*this, other);
+        // Strong, grows the block in place (realloc/mremap) when the buffer supports it
+        constexpr bool try_reallocate(size_type capacity)
+        {
+            const auto old_capacity{ this->capacity() };
+            
+            if (mBuffer.try_expand(capacity)) 
+            { 
+                if (capacity > old_capacity) { record_reallocation(old_capacity, 0); }
+                return true; 
+            }
+
+            if constexpr (buffer_t::is_reallocatable)
+            {
+                if (!std::is_constant_evaluated())
+                {
+                    const T* old_data{ mBuffer.data() };
+                    mBuffer.reallocate(capacity);
+
+                    record_reallocation(old_capacity, old_data == mBuffer.data() ? 0 : mSize);
+                    return true;
+                }
+            }
+
+            return false;
         }
 
-        template <typename U = T>
-            requires std::is_trivially_constructible_v<U>
-        constexpr void construct_and_swap(vector& other)
+        // Strong, constructs one element at the end of a buffer grown to `capacity`, mSize is left to the caller
+        template <typename... Args>
+        constexpr void grow_and_emplace(size_type capacity, Args&&... args)
         {
-            const auto sz{ std::size(other) };
+            if constexpr (buffer_t::is_reallocatable)
+            {
+                if (!std::is_constant_evaluated())
+                {
+                    T value(std::forward<Args>(args)...); // args may refer to an element
+                    try_reallocate(capacity);
+                    std::construct_at(mBuffer.data(mSize), std::move(value));
 
-            std::construct_at(mBuffer.data(sz));
-            std::uninitialized_move_n(std::data(other.mBuffer), sz, std::data(mBuffer));
+                    return;
+                }
+            }
 
-            mSize = other.mSize;
-            swap(*this, other);
+            vector copy(capacity, get_allocator());
+            copy.construct_and_swap(*this, std::forward<Args>(args)...);
         }
 
+        // Strong, constructs n elements at the end of a buffer grown to `capacity`, mSize is left to the caller
         template <typename... Args>
-            requires (sizeof...(Args) >= 1)
-        constexpr void construct_and_swap_n(vector& other, std::size_t n, Args&&... args)
+        constexpr void grow_and_construct_n(size_type capacity, size_type n, const Args&... args)
         {
-            const auto sz{ std::size(other) };
+            if constexpr (buffer_t::is_reallocatable)
+            {
+                if (!std::is_constant_evaluated())
+                {
+                    if constexpr (sizeof...(Args) == 0 || (std::same_as<Args, detail::default_init_t> && ...))
+                    {
+                        try_reallocate(capacity);
+                        detail::uninitialized_construct_with_args_n(n, mBuffer.data(mSize), args...);
+                    }
+                    else 
+                    {
+                        const T value(args...); // args may refer to an element
+                        try_reallocate(capacity);
+                        detail::uninitialized_construct_with_args_n(n, mBuffer.data(mSize), value);
+                    }
+
+                    return;
+                }
+            }
 
-            detail::uninitialized_construct_with_args_n(n, mBuffer.data(sz), std::forward<Args>(args)...);
-            std::uninitialized_move_n(std::data(other.mBuffer), sz, std::data(mBuffer));
+            vector copy(capacity, get_allocator());
+            copy.construct_and_swap_n(*this, n, args...);
+        }
 
-            mSize = other.mSize;
-            swap(*this, other);
+        template <typename... Args>
+        constexpr void construct_and_swap_n(vector& other, std::size_t n, Args&&... args)
+        {
+            detail::uninitialized_construct_with_args_n(n, mBuffer.data(std::size(other)), std::forward<Args>(args)...);
+            
+            relocate_from(other);
+            other.adopt_reallocated(*this, mSize);
+        }
+
+        // Nothrow
+        constexpr void record(const vectorx::stats::counters& delta) noexcept
+        {
+            if constexpr (tracks_stats)
+            {
+                mStats += delta;
+                if (!std::is_constant_evaluated()) { detail::stats_registry.add(delta); }
+            }
         }
 
-        template <typename U = T>
-            requires std::is_trivially_constructible_v<U> 
-        constexpr void construct_and_swap_n(vector& other, std::size_t n)
+        // Nothrow, counts the block obtained by a constructor, inline storage isn't one
+        constexpr void record_allocation() noexcept
         {
-            const auto sz{ std::size(other) };
+            if constexpr (tracks_stats)
+            {
+                if (capacity() <= buffer_t::inline_capacity) { return; }
+
+                const std::size_t bytes{ capacity() * sizeof(T) };
+                record({ .allocations = 1, .bytes_allocated = bytes, .peak_bytes = bytes });
+            }
+        }
 
-            detail::uninitialized_construct_with_args_n(n, mBuffer.data(sz));
-            std::uninitialized_move_n(std::data(other.mBuffer), sz, std::data(mBuffer));
+        // Nothrow, counts a block resized in place or by realloc/mremap
+        constexpr void record_reallocation(size_type old_capacity, size_type relocated) noexcept
+        {
+            if constexpr (tracks_stats)
+            {
+                if (capacity() == 0) { return; }
+
+                const std::size_t bytes{ capacity() * sizeof(T) };
+                record({ 
+                    .allocations = 1, 
+                    .bytes_allocated = bytes, 
+                    .reallocations = std::size_t{ old_capacity != 0 }, 
+                    .elements_relocated = relocated, 
+                    .peak_bytes = bytes 
+                });
+            }
+        }
 
-            mSize = other.mSize;
+        // Nothrow, swaps in the block of `other` built to replace ours. Its allocation is already in the registry.
+        constexpr void adopt(vector& other) noexcept
+        {
             swap(*this, other);
-        } 
+
+            if constexpr (tracks_stats) { mStats += other.mStats; }
+        }
+
+        // Nothrow, adopt() for a block changing the capacity, `relocated` elements were carried over into it
+        constexpr void adopt_reallocated(vector& other, size_type relocated) noexcept
+        {
+            const auto old_capacity{ capacity() };
+            adopt(other);
+
+            if constexpr (tracks_stats)
+            {
+                if (old_capacity != 0) { record({ .reallocations = 1, .elements_relocated = relocated }); }
+            }
+        }
 
     private:
         buffer_t mBuffer;
-        size_type mSize;
+        size_type mSize{};
+        [[no_unique_address]] std::conditional_t<tracks_stats, vectorx::stats::counters, detail::NoStats> mStats{};
+
+        template <typename U, typename A, growth::policy G, typename B, typename Pred>
+        friend constexpr std::size_t erase_if(vector<U, A, G, B>& vec, Pred pred);
     };
 
+    namespace pmr
+    {
+        template <typename T, growth::policy GrowthPolicy = growth::doubling>
+        using vector = vectorx::vector<T, std::pmr::polymorphic_allocator<T>, GrowthPolicy>;
+    } // namespace pmr
+
+    // Block aligned to Alignment bytes, e.g. 64 for cache lines and AVX-512 loads
+    template <typename T, std::size_t Alignment, growth::policy GrowthPolicy = growth::doubling>
+    using aligned_vector = vector<T, std::allocator<T>, GrowthPolicy, detail::Buffer<T, std::allocator<T>, Alignment>>;
+
+    // Blocks of 2 MB and up are mapped on huge page boundaries and advised for transparent huge pages
+    template <typename T, growth::policy GrowthPolicy = growth::doubling>
+    using huge_page_vector = vector<T, std::allocator<T>, GrowthPolicy, detail::Buffer<T, std::allocator<T>, alignof(T), true>>;
+
+    // Counts its allocations and relocations, see vector::stats() and stats::global()
+    template <typename T, growth::policy GrowthPolicy = growth::doubling>
+    using tracked_vector = vector<T, std::allocator<T>, growth::tracked<GrowthPolicy>>;
+
+    // Returns the number of erased elements
+    template <typename T, typename Alloc, growth::policy GrowthPolicy, typename Buffer, typename Pred>
+    constexpr std::size_t erase_if(vector<T, Alloc, GrowthPolicy, Buffer>& vec, Pred pred)
+    {
+        return vec.remove_if(pred);
+    }
+
+    // Returns the number of erased elements
+    template <typename T, typename Alloc, growth::policy GrowthPolicy, typename Buffer, typename U>
+    constexpr std::size_t erase(vector<T, Alloc, GrowthPolicy, Buffer>& vec, const U& value)
+    {
+        const U copy_value(value); // value may refer to an element
+        return erase_if(vec, [&copy_value](const T& el) { return el == copy_value; });
+    }
+
 } // namespace vectorx
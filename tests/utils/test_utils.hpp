@@ -274,13 +274,26 @@ namespace test_utils
                 : mPtr{ new std::int32_t(*rhs.mPtr) }
             { }
 
-            NothrowObjectWithAllocs& operator=(const NothrowObjectWithAllocs&) = default;
+            NothrowObjectWithAllocs& operator=(const NothrowObjectWithAllocs& rhs)
+            {
+                if (this != &rhs)
+                {
+                    NothrowObjectWithAllocs copy{ rhs };
+                    std::swap(mPtr, copy.mPtr);
+                }
+
+                return *this;
+            }
 
             NothrowObjectWithAllocs(NothrowObjectWithAllocs&& rhs) noexcept 
                 : mPtr{ std::exchange(rhs.mPtr, nullptr) }
             { }
 
-            NothrowObjectWithAllocs& operator=(NothrowObjectWithAllocs&&) noexcept = default;
+            NothrowObjectWithAllocs& operator=(NothrowObjectWithAllocs&& rhs) noexcept
+            {
+                std::swap(mPtr, rhs.mPtr);
+                return *this;
+            }
 
             ~NothrowObjectWithAllocs() noexcept { delete mPtr; }
 
@@ -25,6 +25,11 @@
 #include "../headers/vectorx.hpp"
 #include "utils/test_utils.hpp"
 
+#include <sstream>
+#include <memory_resource>
+#include <ranges>
+#include <numeric>
+
 using namespace test_utils::thr_object;
 using namespace test_utils::nothrow_object;
 
@@ -820,4 +825,1130 @@ TEST(VectorX, EraseMiddle)
     EXPECT_EQ(vec[2], 4);
     EXPECT_EQ(vec[3], 5);
     EXPECT_EQ(vec[4], 6);
-}
\ No newline at end of file
+}
+
+TEST(VectorX, EraseMiddleObjectWithAllocs)
+{
+    vectorx::vector<NothrowObjectWithAllocs> vec{};
+    for (std::int32_t i{}; i < 6; ++i)
+    {
+        vec.push_back(NothrowObjectWithAllocs{ i });
+    }
+
+    auto it{ vec.erase(vec.begin() + 2) };
+
+    EXPECT_EQ(std::size(vec), 5);
+    EXPECT_EQ(it->value(), 3);
+
+    EXPECT_EQ(vec[0].value(), 0);
+    EXPECT_EQ(vec[1].value(), 1);
+    EXPECT_EQ(vec[2].value(), 3);
+    EXPECT_EQ(vec[3].value(), 4);
+    EXPECT_EQ(vec[4].value(), 5);
+}
+
+TEST(VectorX, RelocateUniquePtr)
+{
+    static_assert(vectorx::is_trivially_relocatable_v<std::unique_ptr<int>>);
+
+    vectorx::vector<std::unique_ptr<int>> vec{};
+    for (int i{}; i < 100; ++i)
+    {
+        vec.push_back(std::make_unique<int>(i));
+    }
+
+    vec.reserve(1'000);
+    vec.erase(vec.begin() + 50);
+
+    EXPECT_EQ(std::size(vec), 99);
+    EXPECT_EQ(vec.capacity(), 1'000);
+
+    for (int i{}; i < 50; ++i)
+    {
+        EXPECT_EQ(*vec[i], i);
+    }
+
+    for (int i{ 50 }; i < 99; ++i)
+    {
+        EXPECT_EQ(*vec[i], i + 1);
+    }
+}
+
+TEST(VectorX, GrowthPolicies)
+{
+    using namespace vectorx::growth;
+
+    EXPECT_EQ(doubling::next_capacity(0, 1, sizeof(int)), 1);
+    EXPECT_EQ(doubling::next_capacity(8, 9, sizeof(int)), 16);
+    EXPECT_EQ(doubling::next_capacity(8, 100, sizeof(int)), 100);
+
+    EXPECT_EQ(one_and_half::next_capacity(0, 1, sizeof(int)), 2);
+    EXPECT_EQ(one_and_half::next_capacity(8, 9, sizeof(int)), 12);
+
+    EXPECT_EQ(fixed_increment<16>::next_capacity(0, 1, sizeof(int)), 16);
+    EXPECT_EQ(fixed_increment<16>::next_capacity(16, 40, sizeof(int)), 48);
+
+    EXPECT_EQ((page_rounded<doubling, 4096>::next_capacity(0, 1, sizeof(int))), 1'024);
+    EXPECT_EQ((page_rounded<doubling, 4096>::next_capacity(1'024, 1'025, sizeof(int))), 2'048);
+}
+
+TEST(VectorX, FixedIncrementGrowth)
+{
+    vectorx::vector<int, std::allocator<int>, vectorx::growth::fixed_increment<10>> vec{};
+    
+    for (int i{}; i < 25; ++i)
+    {
+        vec.push_back(i);
+        EXPECT_EQ(vec.capacity(), (static_cast<std::size_t>(i) / 10 + 1) * 10);
+    }
+
+    vec.resize(31);
+    EXPECT_EQ(vec.capacity(), 40);
+
+    vec.insert(vec.begin(), 0);
+    EXPECT_EQ(vec.capacity(), 40);
+}
+
+TEST(VectorX, ResizeWithinCapacity)
+{
+    vectorx::vector<NothrowObjectWithAllocs> vec{};
+    vec.reserve(64);
+
+    auto* old_data{ vec.data() };
+    vec.resize(40, NothrowObjectWithAllocs{ 7 });
+
+    EXPECT_EQ(vec.data(), old_data);
+    EXPECT_EQ(vec.capacity(), 64);
+    EXPECT_EQ(std::size(vec), 40);
+
+    for (std::size_t i{}; i < std::size(vec); ++i)
+    {
+        EXPECT_EQ(vec[i].value(), 7);
+    }
+
+    vec.resize(64, vec[0]);
+    
+    EXPECT_EQ(vec.data(), old_data);
+    EXPECT_EQ(vec[63].value(), 7);
+}
+
+TEST(VectorX, ResizeGrowthIsGeometric)
+{
+    vectorx::vector<int> vec{};
+    vec.resize(10);
+
+    EXPECT_EQ(vec.capacity(), 10);
+    
+    vec.resize(11);
+    EXPECT_EQ(vec.capacity(), 20);
+    EXPECT_EQ(vec[10], 0);
+
+    vec.resize(15);
+    EXPECT_EQ(vec.capacity(), 20);
+}
+
+TEST(VectorX, ResizeWithinCapacityThrowOnCopy)
+{
+    using T = ThrowObject<ThrowPolicy::ThrowOnCopy>;
+
+    T o1{ false, 1 };
+    T o2{ true, 2 };
+
+    vectorx::vector<T::internal_obj_t> vec{ o1.mInternalObject };
+    vec.reserve(16);
+
+    try
+    {
+        vec.resize(8, o2.mInternalObject);
+        FAIL() << "exception expected";
+    }
+    catch (const std::runtime_error& e) {}
+
+    EXPECT_EQ(std::size(vec), 1);
+    EXPECT_EQ(vec.capacity(), 16);
+    EXPECT_EQ(vec[0].mMagicValue, 1);
+}
+
+TEST(VectorX, InsertInPlace)
+{
+    vectorx::vector<int> vec{ 1, 2, 3 };
+    vec.reserve(16);
+
+    auto* old_data{ vec.data() };
+    auto it{ vec.insert(vec.begin() + 1, vec[2]) };
+
+    EXPECT_EQ(*it, 3);
+    EXPECT_EQ(vec.data(), old_data);
+    EXPECT_EQ(std::size(vec), 4);
+
+    EXPECT_EQ(vec[0], 1);
+    EXPECT_EQ(vec[1], 3);
+    EXPECT_EQ(vec[2], 2);
+    EXPECT_EQ(vec[3], 3);
+}
+
+TEST(VectorX, InsertCount)
+{
+    vectorx::vector<NothrowObjectWithAllocs> vec{};
+    for (std::int32_t i{}; i < 4; ++i)
+    {
+        vec.push_back(NothrowObjectWithAllocs{ i });
+    }
+
+    vec.insert(vec.begin() + 1, 3, vec[3]);
+    
+    EXPECT_EQ(std::size(vec), 7);
+    
+    const std::int32_t expected[]{ 0, 3, 3, 3, 1, 2, 3 };
+    for (std::size_t i{}; i < std::size(vec); ++i)
+    {
+        EXPECT_EQ(vec[i].value(), expected[i]);
+    }
+
+    vec.insert(vec.begin(), 1, NothrowObjectWithAllocs{ 9 });
+    
+    EXPECT_EQ(std::size(vec), 8);
+    EXPECT_EQ(vec[0].value(), 9);
+    EXPECT_EQ(vec[7].value(), 3);
+}
+
+TEST(VectorX, InsertRange)
+{
+    vectorx::vector<int> vec{ 1, 5 };
+    const int src[]{ 2, 3, 4 };
+
+    auto it{ vec.insert(vec.begin() + 1, std::begin(src), std::end(src)) };
+    EXPECT_EQ(*it, 2);
+
+    vec.insert_range(vec.end(), std::views::iota(6, 9));
+    vec.insert(vec.begin(), { -1, 0 });
+
+    ASSERT_EQ(std::size(vec), 10);
+    for (std::size_t i{}; i < std::size(vec); ++i)
+    {
+        EXPECT_EQ(vec[i], static_cast<int>(i) - 1);
+    }
+}
+
+TEST(VectorX, InsertInputRange)
+{
+    std::istringstream is{ "3 4 5" };
+    vectorx::vector<int> vec{ 1, 2, 6 };
+
+    vec.insert(vec.begin() + 2, std::istream_iterator<int>{ is }, std::istream_iterator<int>{});
+
+    ASSERT_EQ(std::size(vec), 6);
+    for (std::size_t i{}; i < std::size(vec); ++i)
+    {
+        EXPECT_EQ(vec[i], static_cast<int>(i) + 1);
+    }
+}
+
+TEST(VectorX, InsertRangeInPlaceThrow)
+{
+    using T = ThrowObject<ThrowPolicy::ThrowOnCopy>;
+
+    T o1{ false, 1 };
+    T o2{ false, 2 };
+    T o3{ false, 3 };
+    T o4{ false, 4 };
+
+    vectorx::vector<T::internal_obj_t> vec{ o1.mInternalObject, o2.mInternalObject };
+    vec.reserve(16);
+
+    auto* old_data{ vec.data() };
+    const T::internal_obj_t src[]{ o3.mInternalObject, o4.mInternalObject };
+
+    o4.mCanThrow = true;
+
+    try
+    {
+        vec.insert(vec.begin() + 1, std::begin(src), std::end(src));
+        FAIL() << "exception expected";
+    }
+    catch (const std::runtime_error& e) {}
+
+    EXPECT_EQ(vec.data(), old_data);
+    ASSERT_EQ(std::size(vec), 2);
+    
+    EXPECT_EQ(vec[0].mMagicValue, 1);
+    EXPECT_EQ(vec[1].mMagicValue, 2);
+}
+
+TEST(VectorX, Emplace)
+{
+    vectorx::vector<std::unique_ptr<int>> vec{};
+    vec.emplace(vec.begin(), std::make_unique<int>(2));
+    vec.emplace(vec.begin(), std::make_unique<int>(1));
+    vec.emplace(vec.end(), std::make_unique<int>(3));
+
+    ASSERT_EQ(std::size(vec), 3);
+    for (int i{}; i < 3; ++i)
+    {
+        EXPECT_EQ(*vec[i], i + 1);
+    }
+}
+
+TEST(VectorX, EraseRange)
+{
+    vectorx::vector<NothrowObjectWithAllocs> vec{};
+    for (std::int32_t i{}; i < 10; ++i)
+    {
+        vec.push_back(NothrowObjectWithAllocs{ i });
+    }
+
+    auto it{ vec.erase(vec.begin() + 2, vec.begin() + 5) };
+    
+    EXPECT_EQ(it->value(), 5);
+    ASSERT_EQ(std::size(vec), 7);
+
+    const std::int32_t expected[]{ 0, 1, 5, 6, 7, 8, 9 };
+    for (std::size_t i{}; i < std::size(vec); ++i)
+    {
+        EXPECT_EQ(vec[i].value(), expected[i]);
+    }
+
+    it = vec.erase(vec.begin() + 4, vec.end());
+    
+    EXPECT_TRUE(it == vec.end());
+    EXPECT_EQ(std::size(vec), 4);
+
+    vec.erase(vec.begin(), vec.begin());
+    EXPECT_EQ(std::size(vec), 4);
+}
+
+TEST(VectorX, EraseIf)
+{
+    vectorx::vector<int> vec{};
+    for (int i{}; i < 100; ++i)
+    {
+        vec.push_back(i);
+    }
+
+    EXPECT_EQ(vectorx::erase_if(vec, [](int el) { return el % 3 == 0; }), 34);
+    ASSERT_EQ(std::size(vec), 66);
+
+    for (std::size_t i{}; i < std::size(vec); ++i)
+    {
+        EXPECT_NE(vec[i] % 3, 0);
+    }
+
+    EXPECT_EQ(vectorx::erase(vec, vec[0]), 1);
+    EXPECT_EQ(vec[0], 2);
+    EXPECT_EQ(vectorx::erase(vec, 1'000), 0);
+}
+
+TEST(VectorX, Retain)
+{
+    vectorx::vector<std::unique_ptr<int>> vec{};
+    for (int i{}; i < 20; ++i)
+    {
+        vec.push_back(std::make_unique<int>(i));
+    }
+
+    EXPECT_EQ(vec.retain([](const auto& el) { return *el < 5 || *el >= 15; }), 10);
+    ASSERT_EQ(std::size(vec), 10);
+
+    for (int i{}; i < 5; ++i)
+    {
+        EXPECT_EQ(*vec[i], i);
+        EXPECT_EQ(*vec[i + 5], i + 15);
+    }
+
+    vectorx::vector<NothrowObjectWithAllocs> objs{};
+    for (std::int32_t i{}; i < 20; ++i)
+    {
+        objs.push_back(NothrowObjectWithAllocs{ i });
+    }
+
+    EXPECT_EQ(objs.retain([](const auto& el) { return el.value() % 2 == 1; }), 10);
+    for (std::size_t i{}; i < std::size(objs); ++i)
+    {
+        EXPECT_EQ(objs[i].value(), static_cast<std::int32_t>(i * 2 + 1));
+    }
+}
+
+namespace
+{
+    struct CountingResource : std::pmr::memory_resource
+    {
+        void* do_allocate(std::size_t bytes, std::size_t alignment) override
+        {
+            ++AllocCounter;
+            return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+        }
+
+        void do_deallocate(void* ptr, std::size_t bytes, std::size_t alignment) override
+        {
+            ++DeallocCounter;
+            std::pmr::new_delete_resource()->deallocate(ptr, bytes, alignment);
+        }
+
+        bool do_is_equal(const std::pmr::memory_resource& rhs) const noexcept override { return this == &rhs; }
+
+        std::size_t AllocCounter{};
+        std::size_t DeallocCounter{};
+    };
+}
+
+TEST(VectorX, PmrGrowthUsesResource)
+{
+    CountingResource resource{};
+
+    {
+        vectorx::pmr::vector<int> vec{ &resource };
+        for (int i{}; i < 100; ++i)
+        {
+            vec.push_back(i);
+        }
+
+        vec.insert(vec.begin(), 5, -1);
+        vec.resize(1'000);
+        vec.reserve(4'096);
+
+        EXPECT_EQ(vec.get_allocator().resource(), &resource);
+        EXPECT_GT(resource.AllocCounter, 8);
+    }
+
+    EXPECT_EQ(resource.AllocCounter, resource.DeallocCounter);
+}
+
+TEST(VectorX, PmrAssignmentKeepsResource)
+{
+    CountingResource a{};
+    CountingResource b{};
+
+    {
+        vectorx::pmr::vector<int> va{ &a };
+        vectorx::pmr::vector<int> vb{ &b };
+
+        va.push_back(1);
+        vb.push_back(2);
+        vb.push_back(3);
+
+        va = vb;
+        EXPECT_EQ(va.get_allocator().resource(), &a);
+        EXPECT_EQ(std::size(va), 2);
+        EXPECT_EQ(va[1], 3);
+
+        va = std::move(vb);
+        EXPECT_EQ(va.get_allocator().resource(), &a);
+        EXPECT_EQ(vb.get_allocator().resource(), &b);
+        EXPECT_EQ(va[0], 2);
+
+        auto vc{ va };
+        EXPECT_EQ(vc.get_allocator().resource(), std::pmr::get_default_resource());
+
+        vectorx::pmr::vector<int> vd{ std::move(va), &b };
+        EXPECT_EQ(vd.get_allocator().resource(), &b);
+        EXPECT_EQ(vd[1], 3);
+    }
+
+    EXPECT_EQ(a.AllocCounter, a.DeallocCounter);
+    EXPECT_EQ(b.AllocCounter, b.DeallocCounter);
+}
+
+TEST(VectorX, IteratorPairCtorAllocatesOnce)
+{
+    CountingResource resource{};
+    const std::vector<int> src{ 1, 2, 3, 4, 5, 6, 7 };
+
+    {
+        vectorx::pmr::vector<int> vec(std::begin(src), std::end(src), &resource);
+
+        EXPECT_EQ(resource.AllocCounter, 1);
+        EXPECT_EQ(vec.capacity(), std::size(src));
+        EXPECT_TRUE(std::ranges::equal(vec, src));
+    }
+
+    EXPECT_EQ(resource.AllocCounter, resource.DeallocCounter);
+}
+
+TEST(VectorX, FromRangeCtor)
+{
+    const vectorx::vector<int> squares(vectorx::from_range, std::views::iota(0, 6) | std::views::transform([](int i) { return i * i; }));
+
+    ASSERT_EQ(std::size(squares), 6);
+    EXPECT_EQ(squares.capacity(), 6);
+    EXPECT_EQ(squares[5], 25);
+
+    std::istringstream is{ "1 2 3 4" };
+    const vectorx::vector<int> parsed(vectorx::from_range, std::ranges::istream_view<int>(is));
+
+    ASSERT_EQ(std::size(parsed), 4);
+    EXPECT_EQ(parsed[3], 4);
+}
+
+TEST(VectorX, AppendRange)
+{
+    vectorx::vector<std::string> vec{ "a" };
+    const std::string src[]{ "b", "c", "d" };
+
+    vec.append_range(src);
+    vec.append_range(std::vector<std::string>{});
+
+    std::istringstream is{ "e f" };
+    vec.append_range(std::ranges::istream_view<std::string>(is));
+
+    ASSERT_EQ(std::size(vec), 6);
+    EXPECT_EQ(vec[3], "d");
+    EXPECT_EQ(vec[5], "f");
+}
+
+TEST(VectorX, AppendRangeThrow)
+{
+    using T = ThrowObject<ThrowPolicy::ThrowOnCopy>;
+
+    T o1{ false, 1 };
+    T o2{ false, 2 };
+    T o3{ false, 3 };
+
+    vectorx::vector<T::internal_obj_t> vec{ o1.mInternalObject };
+    vec.reserve(16);
+
+    const T::internal_obj_t src[]{ o2.mInternalObject, o3.mInternalObject };
+    o3.mCanThrow = true;
+
+    EXPECT_THROW(vec.append_range(src), std::runtime_error);
+    ASSERT_EQ(std::size(vec), 1);
+    EXPECT_EQ(vec[0].mMagicValue, 1);
+
+    EXPECT_THROW((vectorx::vector<T::internal_obj_t>(std::begin(src), std::end(src))), std::runtime_error);
+}
+
+TEST(VectorX, Assign)
+{
+    vectorx::vector<std::string> vec{ "x", "y", "z", "w" };
+    auto* old_data{ vec.data() };
+
+    vec.assign({ "a", "b" });
+    EXPECT_EQ(vec.data(), old_data);
+    ASSERT_EQ(std::size(vec), 2);
+    EXPECT_EQ(vec[1], "b");
+
+    vec.assign(3, vec[0]);
+    EXPECT_EQ(vec.data(), old_data);
+    ASSERT_EQ(std::size(vec), 3);
+    EXPECT_EQ(vec[2], "a");
+
+    const std::vector<std::string> src(10, "q");
+    vec.assign(std::begin(src), std::end(src));
+    ASSERT_EQ(std::size(vec), 10);
+    EXPECT_EQ(vec.capacity(), 10);
+    EXPECT_EQ(vec[9], "q");
+
+    std::istringstream is{ "m n" };
+    vec.assign_range(std::ranges::istream_view<std::string>(is));
+    ASSERT_EQ(std::size(vec), 2);
+    EXPECT_EQ(vec[0], "m");
+
+    vec.assign(12, "r");
+    ASSERT_EQ(std::size(vec), 12);
+    EXPECT_EQ(vec[11], "r");
+}
+
+TEST(VectorX, ResizeForOverwrite)
+{
+    vectorx::vector<int> vec{ 1, 2, 3 };
+
+    vec.resize_for_overwrite(1'000);
+    ASSERT_EQ(std::size(vec), 1'000);
+    EXPECT_EQ(vec[2], 3);
+
+    std::iota(vec.begin() + 3, vec.end(), 4);
+    EXPECT_EQ(vec[999], 1'000);
+
+    auto* old_data{ vec.data() };
+    vec.resize_for_overwrite(10);
+    vec.resize_for_overwrite(20);
+    EXPECT_EQ(vec.data(), old_data);
+    EXPECT_EQ(vec[9], 10);
+
+    vectorx::vector<std::string> strings{ "a" };
+    strings.resize_for_overwrite(3);
+    ASSERT_EQ(std::size(strings), 3);
+    EXPECT_EQ(strings[0], "a");
+    EXPECT_TRUE(strings[2].empty());
+}
+
+TEST(VectorX, PushBackUnchecked)
+{
+    vectorx::vector<std::string> vec{};
+    vec.reserve(3);
+
+    auto* old_data{ vec.data() };
+    vec.push_back_unchecked("a");
+
+    const std::string b{ "b" };
+    vec.push_back_unchecked(b);
+    EXPECT_EQ(vec.emplace_back_unchecked(2, 'c'), "cc");
+
+    EXPECT_EQ(vec.data(), old_data);
+    ASSERT_EQ(std::size(vec), 3);
+    EXPECT_EQ(vec[1], "b");
+}
+
+TEST(VectorX, AppendCursor)
+{
+    vectorx::vector<int> vec{ -1 };
+
+    {
+        auto cursor{ vec.begin_append(100) };
+        EXPECT_GE(cursor.remaining(), 100);
+
+        for (int i{}; i < 100; ++i)
+        {
+            cursor.push_back(i);
+        }
+
+        EXPECT_EQ(std::size(vec), 1);
+    }
+
+    ASSERT_EQ(std::size(vec), 101);
+    EXPECT_EQ(vec[0], -1);
+    EXPECT_EQ(vec[100], 99);
+}
+
+TEST(VectorX, AppendCursorThrow)
+{
+    using T = ThrowObject<ThrowPolicy::ThrowOnCopy>;
+
+    T o1{ false, 1 };
+    T o2{ true, 2 };
+
+    vectorx::vector<T::internal_obj_t> vec{};
+
+    try
+    {
+        auto cursor{ vec.begin_append(2) };
+        cursor.push_back(o1.mInternalObject);
+        cursor.push_back(o2.mInternalObject);
+        FAIL() << "exception expected";
+    }
+    catch (const std::runtime_error& e) {}
+
+    ASSERT_EQ(std::size(vec), 1);
+    EXPECT_EQ(vec[0].mMagicValue, 1);
+}
+
+TEST(VectorX, EqualityChecksSize)
+{
+    vectorx::vector<int> a{ 1, 2, 3 };
+    vectorx::vector<int> longer{ 1, 2, 3, 4 };
+    vectorx::vector<int> empty{};
+
+    EXPECT_TRUE(a != longer);
+    EXPECT_TRUE(longer != a);
+    EXPECT_TRUE(a != empty);
+    EXPECT_TRUE(empty == vectorx::vector<int>{});
+
+    vectorx::vector<std::string> s1{ "a", "b" };
+    vectorx::vector<std::string> s2{ "a" };
+    EXPECT_TRUE(s1 != s2);
+    s2.push_back("b");
+    EXPECT_TRUE(s1 == s2);
+}
+
+TEST(VectorX, ThreeWayComparison)
+{
+    vectorx::vector<unsigned char> b1{ 1, 2, 200 };
+    vectorx::vector<unsigned char> b2{ 1, 2, 3, 4 };
+    EXPECT_TRUE(b1 > b2);
+    EXPECT_TRUE(b2 < b1);
+    EXPECT_TRUE((b1 <=> b1) == std::strong_ordering::equal);
+
+    vectorx::vector<unsigned> u1{};
+    vectorx::vector<unsigned> u2{};
+    u1.resize(1'000, 7u);
+    u2.resize(1'000, 7u);
+    EXPECT_TRUE((u1 <=> u2) == std::strong_ordering::equal);
+
+    u2[900] = 0x0100;
+    u1[900] = 0x00ff;
+    EXPECT_TRUE(u1 < u2); // a byte-wise comparison would order these the other way on little endian
+
+    u1.resize(999);
+    u2[900] = 0x00ff;
+    EXPECT_TRUE(u1 < u2);
+
+    vectorx::vector<int> i1{ -1 };
+    vectorx::vector<int> i2{ 1 };
+    EXPECT_TRUE(i1 < i2);
+
+    vectorx::vector<double> d1{ 1.0, std::numeric_limits<double>::quiet_NaN() };
+    vectorx::vector<double> d2{ 1.0, 2.0 };
+    EXPECT_TRUE((d1 <=> d2) == std::partial_ordering::unordered);
+
+    vectorx::vector<std::string> s1{ "a", "b" };
+    vectorx::vector<std::string> s2{ "a", "c" };
+    EXPECT_TRUE(s1 < s2);
+}
+
+TEST(VectorX, AlignedVector)
+{
+    vectorx::aligned_vector<float, 64> vec{};
+
+    for (int i{}; i < 1'000; ++i)
+    {
+        vec.push_back(static_cast<float>(i));
+        ASSERT_EQ(reinterpret_cast<std::uintptr_t>(vec.data()) % 64, 0u);
+    }
+
+    EXPECT_EQ(vec[999], 999.0f);
+
+    auto copy{ vec };
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(copy.data()) % 64, 0u);
+    EXPECT_TRUE(copy == vec);
+}
+
+TEST(VectorX, HugePageVector)
+{
+    vectorx::huge_page_vector<std::uint64_t> vec{};
+    vec.resize(1 << 20, 7u);
+    vec.push_back(8u);
+
+    ASSERT_EQ(std::size(vec), (1u << 20) + 1);
+    EXPECT_EQ(vec[12'345], 7u);
+    EXPECT_EQ(vec[1 << 20], 8u);
+
+    // A page mapped right past the block keeps growth from extending in place, the moved block must stay aligned
+    for (int i{}; i < 4; ++i)
+    {
+        auto* past_end{ reinterpret_cast<std::byte*>(vec.data() + vec.capacity()) };
+        past_end += (vectorx::detail::pages::size() - reinterpret_cast<std::uintptr_t>(past_end) % vectorx::detail::pages::size()) % vectorx::detail::pages::size();
+
+        void* guard{ ::mmap(past_end, vectorx::detail::pages::size(), PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE, -1, 0) };
+        vec.reserve(vec.capacity() * 2);
+
+        if (guard != MAP_FAILED) { ::munmap(guard, vectorx::detail::pages::size()); }
+        ASSERT_EQ(reinterpret_cast<std::uintptr_t>(vec.data()) % vectorx::detail::pages::huge_size, 0u);
+    }
+
+    EXPECT_EQ(vec[12'345], 7u);
+    EXPECT_EQ(vec[1 << 20], 8u);
+}
+
+TEST(VectorX, ShrinkToFit)
+{
+    vectorx::vector<int> ints{};
+    ints.reserve(1'000);
+    ints.resize(10, 3);
+
+    ints.shrink_to_fit();
+
+    EXPECT_EQ(ints.capacity(), 10u);
+    EXPECT_TRUE(std::ranges::all_of(ints, [](int i) { return i == 3; }));
+
+    vectorx::vector<std::string> strings{};
+    strings.reserve(64);
+    strings.push_back(std::string(100, 'x'));
+
+    strings.shrink_to_fit();
+
+    EXPECT_EQ(strings.capacity(), 1u);
+    EXPECT_EQ(strings[0], std::string(100, 'x'));
+
+    strings.clear();
+    strings.shrink_to_fit();
+
+    EXPECT_EQ(strings.capacity(), 0u);
+}
+
+TEST(VectorX, Clear)
+{
+    vectorx::vector<std::shared_ptr<int>> vec{};
+    auto ptr{ std::make_shared<int>(1) };
+    vec.resize(10, ptr);
+
+    vec.clear();
+
+    EXPECT_TRUE(vec.empty());
+    EXPECT_GE(vec.capacity(), 10u);
+    EXPECT_EQ(ptr.use_count(), 1);
+}
+
+TEST(VectorX, TrimmingPolicy)
+{
+    vectorx::vector<int, std::allocator<int>, vectorx::growth::trimming<>> vec{};
+    vec.resize(64);
+    ASSERT_EQ(vec.capacity(), 64u);
+
+    vec.resize(16); // exactly capacity / 4 stays
+    EXPECT_EQ(vec.capacity(), 64u);
+
+    vec.erase(vec.end() - 1);
+    EXPECT_EQ(vec.capacity(), 30u);
+    EXPECT_EQ(std::size(vec), 15u);
+
+    // Hysteresis: popping and pushing around the new size doesn't reallocate
+    for (int i{}; i < 10; ++i)
+    {
+        vec.push_back(i);
+        vec.erase(vec.end() - 1);
+    }
+    EXPECT_EQ(vec.capacity(), 30u);
+
+    vectorx::erase_if(vec, [](int) { return true; });
+    EXPECT_EQ(vec.capacity(), 0u);
+
+    vec.resize(8, 1);
+    vec.clear();
+    EXPECT_EQ(vec.capacity(), 0u);
+}
+
+TEST(VectorX, ReleaseUnusedPages)
+{
+    vectorx::vector<std::uint64_t> vec{};
+    vec.resize((64u << 20) / sizeof(std::uint64_t), 7u);
+    const auto* ptr{ vec.data() };
+
+    vec.resize(1'000);
+    vec.release_unused_pages();
+
+    EXPECT_EQ(vec.data(), ptr);
+    EXPECT_EQ(vec.capacity(), (64u << 20) / sizeof(std::uint64_t));
+    EXPECT_EQ(vec[999], 7u);
+
+    vec.resize(2'000, 8u);
+    EXPECT_EQ(vec[1'999], 8u);
+}
+
+namespace
+{
+    template <typename Vec>
+    concept has_stats = requires (const Vec& vec) { vec.stats(); };
+}
+
+TEST(VectorX, StatsDisabledByDefault)
+{
+    static_assert(sizeof(vectorx::vector<int>) == sizeof(vectorx::detail::Buffer<int>) + sizeof(std::size_t));
+    static_assert(!has_stats<vectorx::vector<int>>);
+    static_assert(has_stats<vectorx::tracked_vector<int>>);
+}
+
+TEST(VectorX, StatsPerVector)
+{
+    vectorx::tracked_vector<std::string> vec{};
+    for (int i{}; i < 100; ++i)
+    {
+        vec.push_back(std::to_string(i));
+    }
+
+    // Capacities 1, 2, 4, ..., 128
+    EXPECT_EQ(vec.stats().allocations, 8u);
+    EXPECT_EQ(vec.stats().reallocations, 7u);
+    EXPECT_EQ(vec.stats().elements_relocated, 127u);
+    EXPECT_EQ(vec.stats().bytes_allocated, 255 * sizeof(std::string));
+    EXPECT_EQ(vec.stats().peak_bytes, 128 * sizeof(std::string));
+
+    vec.shrink_to_fit();
+
+    EXPECT_EQ(vec.stats().reallocations, 8u);
+    EXPECT_EQ(vec.stats().elements_relocated, 227u);
+    EXPECT_EQ(vec.stats().peak_bytes, 128 * sizeof(std::string));
+
+    const auto moved{ std::move(vec) };
+    EXPECT_EQ(moved.stats(), vectorx::stats::counters{});
+
+    const auto copy{ moved };
+    EXPECT_EQ(copy.stats().allocations, 1u);
+    EXPECT_EQ(copy.stats().reallocations, 0u);
+    EXPECT_EQ(copy.stats().bytes_allocated, 100 * sizeof(std::string));
+}
+
+TEST(VectorX, StatsReallocatable)
+{
+    vectorx::tracked_vector<int> vec{};
+    vec.reserve(4);
+    vec.resize(4, 1);
+    vec.insert(vec.begin(), 0);
+
+    EXPECT_EQ(vec.stats().allocations, 2u);
+    EXPECT_EQ(vec.stats().reallocations, 1u);
+    EXPECT_EQ(vec.stats().peak_bytes, 8 * sizeof(int));
+    EXPECT_EQ(std::size(vec), 5u);
+}
+
+TEST(VectorX, StatsGlobal)
+{
+    vectorx::stats::reset_global();
+
+    vectorx::tracked_vector<std::uint64_t> small{};
+    small.resize(10);
+
+    vectorx::tracked_vector<std::string> large(100);
+    large.push_back("x");
+
+    auto expected{ small.stats() };
+    expected += large.stats();
+
+    EXPECT_EQ(vectorx::stats::global(), expected);
+    EXPECT_EQ(vectorx::stats::global().peak_bytes, 100 * sizeof(std::string));
+
+    vectorx::vector<int> untracked(1'000);
+    untracked.resize(2'000);
+    EXPECT_EQ(vectorx::stats::global(), expected);
+
+    vectorx::stats::reset_global();
+    EXPECT_EQ(vectorx::stats::global(), vectorx::stats::counters{});
+}
+
+TEST(VectorX, StatsWithTrimming)
+{
+    vectorx::vector<int, std::allocator<int>, vectorx::growth::tracked<vectorx::growth::trimming<>>> vec{};
+    vec.resize(64);
+    vec.resize(1);
+
+    EXPECT_EQ(vec.capacity(), 2u);
+    EXPECT_EQ(vec.stats().allocations, 2u);
+    EXPECT_EQ(vec.stats().reallocations, 1u);
+}
+
+TEST(VectorX, StatsThroughWrappedPolicies)
+{
+    static_assert(vectorx::vector<int, std::allocator<int>, vectorx::growth::trimming<vectorx::growth::tracked<>>>::tracks_stats);
+    static_assert(vectorx::vector<int, std::allocator<int>, vectorx::growth::page_rounded<vectorx::growth::tracked<>>>::tracks_stats);
+    static_assert(!vectorx::vector<int, std::allocator<int>, vectorx::growth::trimming<>>::tracks_stats);
+
+    vectorx::vector<int, std::allocator<int>, vectorx::growth::trimming<vectorx::growth::tracked<>>> vec{};
+    vec.resize(64);
+    vec.resize(1);
+
+    EXPECT_EQ(vec.capacity(), 2u);
+    EXPECT_EQ(vec.stats().allocations, 2u);
+    EXPECT_EQ(vec.stats().reallocations, 1u);
+}
+
+TEST(VectorX, StatsShrinkToFit)
+{
+    vectorx::vector<int, std::allocator<int>, vectorx::growth::tracked<>> vec{};
+    vec.resize(100);
+    const auto before{ vec.stats() };
+
+    vec.shrink_to_fit();
+    EXPECT_EQ(vec.stats(), before);
+
+    vec.resize(10);
+    vec.shrink_to_fit();
+
+    ASSERT_EQ(vec.capacity(), 10u);
+    EXPECT_EQ(vec.stats().allocations, before.allocations + 1);
+    EXPECT_EQ(vec.stats().reallocations, before.reallocations + 1);
+    EXPECT_EQ(vec.stats().bytes_allocated, before.bytes_allocated + 10 * sizeof(int));
+
+    vec.shrink_to_fit();
+    EXPECT_EQ(vec.stats().allocations, before.allocations + 1);
+}
+
+namespace
+{
+    // Forces every bulk operation through the parallel path for the duration of a test
+    struct ParallelScope
+    {
+        ParallelScope(unsigned threads)
+            : mThreshold{ vectorx::parallel::threshold_bytes.exchange(0) }
+            , mThreads{ vectorx::parallel::max_threads.exchange(threads) }
+        { }
+
+        ~ParallelScope()
+        {
+            vectorx::parallel::threshold_bytes = mThreshold;
+            vectorx::parallel::max_threads = mThreads;
+        }
+
+        std::size_t mThreshold;
+        unsigned mThreads;
+    };
+
+    // Counts live instances across threads, the copy numbered ThrowAt throws
+    struct CountedCopy
+    {
+        static inline std::atomic<int> Live{};
+        static inline std::atomic<int> Copies{};
+        static inline int ThrowAt{ -1 };
+
+        CountedCopy() { ++Live; }
+        CountedCopy(const CountedCopy&)
+        {
+            if (Copies++ == ThrowAt) { throw std::runtime_error{ "copy" }; }
+            ++Live;
+        }
+        CountedCopy(CountedCopy&&) noexcept { ++Live; }
+        CountedCopy& operator=(const CountedCopy&) = default;
+        CountedCopy& operator=(CountedCopy&&) noexcept = default;
+        ~CountedCopy() { --Live; }
+    };
+
+    // Plain stores: any thread but the caller copying or moving it would be a data race
+    struct CallerOnly
+    {
+        CallerOnly() = default;
+        CallerOnly(const CallerOnly&) { Foreign |= std::this_thread::get_id() != Caller; }
+        CallerOnly(CallerOnly&&) noexcept { Foreign |= std::this_thread::get_id() != Caller; }
+        CallerOnly& operator=(const CallerOnly&) = default;
+        CallerOnly& operator=(CallerOnly&&) noexcept = default;
+
+        static inline std::thread::id Caller{ std::this_thread::get_id() };
+        static inline bool Foreign{};
+    };
+
+    // Counts moves made off the calling thread, for operations that are allowed to make them
+    struct Tagged
+    {
+        Tagged(int value) : mValue{ value } { }
+        Tagged(const Tagged&) = default;
+        Tagged(Tagged&& rhs) noexcept : mValue{ rhs.mValue } { Foreign += std::this_thread::get_id() != Caller; }
+        Tagged& operator=(const Tagged&) = default;
+        Tagged& operator=(Tagged&&) noexcept = default;
+
+        int mValue;
+
+        static inline std::thread::id Caller{ std::this_thread::get_id() };
+        static inline std::atomic<int> Foreign{};
+    };
+}
+
+TEST(VectorX, ParallelCopyAndFill)
+{
+    ParallelScope scope{ 4 };
+
+    vectorx::vector<std::string> strings{};
+    strings.resize(vectorx::parallel::par, 10'001, std::string(40, 'x'));
+    EXPECT_TRUE(std::ranges::all_of(strings, [](const auto& s) { return s == std::string(40, 'x'); }));
+
+    for (std::size_t i{}; i < std::size(strings); ++i)
+    {
+        strings[i] = std::to_string(i);
+    }
+
+    const vectorx::vector<std::string> copy(vectorx::parallel::par, strings);
+    EXPECT_TRUE(copy == strings);
+
+    strings.resize(vectorx::parallel::par, 10'005, strings[3]);
+    EXPECT_EQ(strings[10'004], "3");
+
+    vectorx::vector<int> ints{};
+    ints.resize(100'003);
+    std::iota(ints.begin(), ints.end(), 0);
+
+    const vectorx::vector<int> ints_copy(ints.begin(), ints.end());
+    EXPECT_TRUE(ints_copy == ints);
+}
+
+TEST(VectorX, ParallelCopyRollsBack)
+{
+    ParallelScope scope{ 4 };
+
+    {
+        vectorx::vector<CountedCopy> vec{};
+        vec.resize(1'000);
+        ASSERT_EQ(CountedCopy::Live, 1'000);
+
+        CountedCopy::Copies = 0;
+        CountedCopy::ThrowAt = 600;
+
+        EXPECT_THROW(vectorx::vector<CountedCopy>(vectorx::parallel::par, vec), std::runtime_error);
+        EXPECT_EQ(CountedCopy::Live, 1'000);
+
+        CountedCopy::Copies = 0;
+        EXPECT_THROW(vec.resize(vectorx::parallel::par, 2'000, CountedCopy{}), std::runtime_error);
+        EXPECT_EQ(std::size(vec), 1'000);
+        EXPECT_EQ(CountedCopy::Live, 1'000);
+
+        CountedCopy::ThrowAt = -1;
+    }
+
+    EXPECT_EQ(CountedCopy::Live, 0);
+}
+
+TEST(VectorX, ParallelOnlyWhenAsked)
+{
+    ParallelScope scope{ 4 };
+
+    vectorx::vector<CallerOnly> vec{};
+    vec.resize(10'000, CallerOnly{});
+    const auto copy{ vec };
+    
+    int calls{};
+    const vectorx::vector<int> mapped(vectorx::from_range, std::views::iota(0, 10'000) | std::views::transform([&](int i) { ++calls; return i; }));
+
+    EXPECT_FALSE(CallerOnly::Foreign);
+    EXPECT_EQ(calls, 10'000);
+    EXPECT_EQ(std::size(copy), 10'000);
+    EXPECT_EQ(mapped[9'999], 9'999);
+}
+
+TEST(VectorX, ParallelRelocation)
+{
+    ParallelScope scope{ 3 };
+
+    vectorx::vector<std::string> strings{};
+
+    // Trivially relocatable, but a pmr allocator can't realloc: growth relocates into new blocks, split across threads
+    std::pmr::unsynchronized_pool_resource pool{};
+    vectorx::pmr::vector<std::unique_ptr<int>> owners{ &pool };
+    static_assert(vectorx::is_trivially_relocatable_v<std::unique_ptr<int>> && !decltype(owners)::buffer_t::is_reallocatable);
+
+    for (int i{}; i < 5'000; ++i)
+    {
+        strings.push_back(std::to_string(i) + std::string(20, '.'));
+        owners.push_back(std::make_unique<int>(i));
+    }
+
+    strings.reserve(50'000);
+    strings.insert(strings.begin() + 10, std::size_t{ 50'000 }, std::string{ "gap" });
+
+    ASSERT_EQ(std::size(strings), 55'000);
+    EXPECT_EQ(strings[9], "9" + std::string(20, '.'));
+    EXPECT_EQ(strings[10], "gap");
+    EXPECT_EQ(strings[50'010], "10" + std::string(20, '.'));
+    EXPECT_EQ(strings[54'999], "4999" + std::string(20, '.'));
+
+    for (int i{}; i < 5'000; ++i)
+    {
+        ASSERT_EQ(*owners[static_cast<std::size_t>(i)], i);
+    }
+
+    // Move constructors only run on the caller
+    vectorx::vector<CallerOnly> movable{};
+    movable.resize(10'000, CallerOnly{});
+    movable.reserve(20'000);
+    
+    EXPECT_FALSE(CallerOnly::Foreign);
+}
+
+TEST(VectorX, ParallelReserve)
+{
+    ParallelScope scope{ 4 };
+
+    vectorx::vector<Tagged> tagged{};
+    for (int i{}; i < 10'000; ++i)
+    {
+        tagged.push_back(Tagged{ i });
+    }
+
+    Tagged::Foreign = 0;
+    tagged.reserve(vectorx::parallel::par, 40'000);
+
+    EXPECT_GT(Tagged::Foreign, 0);
+    ASSERT_GE(tagged.capacity(), 40'000u);
+    for (int i{}; i < 10'000; ++i)
+    {
+        ASSERT_EQ(tagged[static_cast<std::size_t>(i)].mValue, i);
+    }
+
+    // Trivially relocatable elements skip realloc/mremap and are copied to the new block in slices
+    vectorx::vector<int> ints{};
+    ints.resize(100'003);
+    std::iota(ints.begin(), ints.end(), 0);
+
+    ints.reserve(vectorx::parallel::par, 300'000);
+    ASSERT_EQ(std::size(ints), 100'003u);
+    for (std::size_t i{}; i < std::size(ints); ++i)
+    {
+        ASSERT_EQ(ints[i], static_cast<int>(i));
+    }
+
+    ints.reserve(vectorx::parallel::par, 10);
+    EXPECT_GE(ints.capacity(), 300'000u);
+}
@@ -0,0 +1,119 @@
+// MIT License
+// 
+// Copyright (c) 2025 Mr. Myxa
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include <gtest/gtest.h>
+
+#include "../headers/concurrent_vector.hpp"
+
+#include <algorithm>
+#include <string>
+#include <thread>
+#include <vector>
+
+static_assert(std::random_access_iterator<vectorx::concurrent_vector<int>::iterator>);
+
+TEST(ConcurrentVector, ConcurrentPushBack)
+{
+    constexpr int threads{ 8 };
+    constexpr int per_thread{ 20'000 };
+
+    vectorx::concurrent_vector<int, 16> vec{};
+
+    {
+        std::vector<std::jthread> workers{};
+        for (int t{}; t < threads; ++t)
+        {
+            workers.emplace_back([&vec, t]
+            {
+                for (int i{}; i < per_thread; ++i)
+                {
+                    auto it{ vec.push_back(t * per_thread + i) };
+                    ASSERT_EQ(*it, t * per_thread + i);
+                }
+            });
+        }
+    }
+
+    ASSERT_EQ(std::size(vec), static_cast<std::size_t>(threads * per_thread));
+
+    std::vector<int> values(vec.begin(), vec.end());
+    std::ranges::sort(values);
+
+    for (int i{}; i < threads * per_thread; ++i)
+    {
+        ASSERT_EQ(values[static_cast<std::size_t>(i)], i);
+    }
+}
+
+TEST(ConcurrentVector, GrowByIsContiguous)
+{
+    vectorx::concurrent_vector<long, 8> vec{};
+
+    {
+        std::vector<std::jthread> workers{};
+        for (long t{}; t < 4; ++t)
+        {
+            workers.emplace_back([&vec, t]
+            {
+                for (int round{}; round < 500; ++round)
+                {
+                    auto first{ vec.grow_by(7, t) };
+                    for (int i{}; i < 7; ++i)
+                    {
+                        first[i] = t; // the slots belong to this thread alone
+                    }
+                }
+            });
+        }
+    }
+
+    ASSERT_EQ(std::size(vec), 4u * 500u * 7u);
+
+    for (std::size_t run{}; run < std::size(vec); run += 7)
+    {
+        ASSERT_TRUE(std::all_of(vec.begin() + static_cast<std::ptrdiff_t>(run), vec.begin() + static_cast<std::ptrdiff_t>(run + 7), 
+                                [&](long v) { return v == vec[run]; }));
+    }
+}
+
+TEST(ConcurrentVector, StableReferences)
+{
+    vectorx::concurrent_vector<std::string, 2> vec{};
+    vec.reserve(3);
+
+    const std::string& first{ vec.emplace_back(3, 'a') };
+
+    for (int i{}; i < 1'000; ++i)
+    {
+        vec.push_back(first);
+    }
+
+    EXPECT_EQ(&vec[0], &first);
+    EXPECT_EQ(vec[1'000], "aaa");
+    EXPECT_EQ(*vec.grow_by(2), "");
+
+    vec.clear();
+    EXPECT_TRUE(vec.empty());
+    vec.push_back("b");
+    EXPECT_EQ(vec[0], "b");
+}
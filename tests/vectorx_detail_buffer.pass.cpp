@@ -246,4 +246,162 @@ TEST(BufferTest, InvariantsAfterCopyAssignmentThrow)
 
     EXPECT_EQ(a.data(), a_old_ptr);
     EXPECT_EQ(a.capacity(), a_old_cap);
-}
\ No newline at end of file
+}
+
+TEST(BufferTest, ReallocatePreservesContents)
+{
+    static_assert(Buffer<int>::is_reallocatable);
+    
+    Buffer<int> buf{ 4 };
+    for (int i{}; i < 4; ++i)
+    {
+        *buf.data(i) = i;
+    }
+
+    buf.reallocate(1'024);
+
+    EXPECT_EQ(buf.capacity(), 1'024u);
+    for (int i{}; i < 4; ++i)
+    {
+        EXPECT_EQ(*buf.data(i), i);
+    }
+}
+
+TEST(BufferTest, ReallocateMappedBlock)
+{
+    using B = Buffer<std::byte>;
+    
+    B buf{ 16 };
+    *buf.data(0) = std::byte{ 0x11 };
+    *buf.data(15) = std::byte{ 0x22 };
+
+    buf.reallocate(B::mapped_threshold);
+    *buf.data(B::mapped_threshold - 1) = std::byte{ 0x33 };
+
+    buf.reallocate(B::mapped_threshold * 2);
+    
+    EXPECT_EQ(buf.capacity(), B::mapped_threshold * 2);
+    EXPECT_EQ(*buf.data(0), std::byte{ 0x11 });
+    EXPECT_EQ(*buf.data(15), std::byte{ 0x22 });
+    EXPECT_EQ(*buf.data(B::mapped_threshold - 1), std::byte{ 0x33 });
+}
+
+TEST(BufferTest, TryExpandWithinCapacity)
+{
+    Buffer<int> buf{ 8 };
+    int* ptr{ buf.data() };
+
+    EXPECT_TRUE(buf.try_expand(8));
+    EXPECT_EQ(buf.capacity(), 8u);
+    EXPECT_EQ(buf.data(), ptr);
+}
+
+TEST(BufferTest, TryExpandCustomAllocator)
+{
+    using T = ThrowingAllocator<int, ThrowOn::Alloc>; 
+    T alloc{ false };
+    
+    Buffer<int, T::internal_alloc_t> buf{ 4, alloc.mInternalAlloc };
+    
+    EXPECT_FALSE(buf.try_expand(16));
+    EXPECT_EQ(buf.capacity(), 4u);
+    EXPECT_EQ(alloc.mStats.AllocCounter, 1);
+}
+
+TEST(BufferTest, OverAligned)
+{
+    using B = Buffer<int, std::allocator<int>, 64>;
+    static_assert(!B::is_reallocatable && B::is_raw);
+
+    for (std::size_t n : { std::size_t{ 1 }, std::size_t{ 17 }, std::size_t{ 1'000 } })
+    {
+        B buf{ n };
+        EXPECT_EQ(reinterpret_cast<std::uintptr_t>(buf.data()) % 64, 0u);
+    }
+
+    using Small = Buffer<char, std::allocator<char>, 16>;
+    static_assert(Small::is_reallocatable);
+
+    Small buf{ 3 };
+    *buf.data(2) = 'x';
+    buf.reallocate(1'000);
+    
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(buf.data()) % 16, 0u);
+    EXPECT_EQ(*buf.data(2), 'x');
+}
+
+TEST(BufferTest, HugePages)
+{
+    using B = Buffer<std::byte, std::allocator<std::byte>, alignof(std::byte), true>;
+    static_assert(B::mapped_threshold == pages::huge_size);
+
+    B buf{ pages::huge_size };
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(buf.data()) % pages::huge_size, 0u);
+
+    *buf.data(0) = std::byte{ 0x11 };
+    *buf.data(pages::huge_size - 1) = std::byte{ 0x22 };
+
+    buf.reallocate(pages::huge_size * 3);
+
+    EXPECT_EQ(*buf.data(0), std::byte{ 0x11 });
+    EXPECT_EQ(*buf.data(pages::huge_size - 1), std::byte{ 0x22 });
+}
+
+TEST(BufferTest, Shrink)
+{
+    Buffer<int> buf{ 1'024 };
+    for (int i{}; i < 4; ++i)
+    {
+        *buf.data(i) = i;
+    }
+
+    buf.shrink(4);
+
+    EXPECT_EQ(buf.capacity(), 4u);
+    for (int i{}; i < 4; ++i)
+    {
+        EXPECT_EQ(*buf.data(i), i);
+    }
+
+    buf.shrink(0);
+    EXPECT_EQ(buf.capacity(), 0u);
+    EXPECT_EQ(buf.data(), nullptr);
+}
+
+TEST(BufferTest, ShrinkMappedBlock)
+{
+    using B = Buffer<std::byte>;
+
+    B buf{ B::mapped_threshold * 2 };
+    std::byte* ptr{ buf.data() };
+    *buf.data(0) = std::byte{ 0x11 };
+    *buf.data(B::mapped_threshold - 1) = std::byte{ 0x22 };
+
+    buf.shrink(B::mapped_threshold);
+
+    EXPECT_EQ(buf.capacity(), B::mapped_threshold);
+    EXPECT_EQ(buf.data(), ptr);
+    EXPECT_EQ(*buf.data(B::mapped_threshold - 1), std::byte{ 0x22 });
+
+    buf.shrink(16);
+
+    EXPECT_EQ(buf.capacity(), 16u);
+    EXPECT_EQ(*buf.data(0), std::byte{ 0x11 });
+}
+
+TEST(BufferTest, ReleaseUnused)
+{
+    using B = Buffer<std::byte>;
+
+    B buf{ B::mapped_threshold };
+    std::memset(buf.data(), 0x5a, B::mapped_threshold);
+
+    const auto used{ pages::size() + 1 };
+    buf.release_unused(used);
+
+    EXPECT_EQ(buf.capacity(), B::mapped_threshold);
+    EXPECT_EQ(*buf.data(used - 1), std::byte{ 0x5a });
+    EXPECT_EQ(*buf.data(2 * pages::size() - 1), std::byte{ 0x5a }); // same page as the last used byte
+    EXPECT_EQ(*buf.data(2 * pages::size()), std::byte{ 0 });
+    EXPECT_EQ(*buf.data(B::mapped_threshold - 1), std::byte{ 0 });
+}
@@ -0,0 +1,161 @@
+// MIT License
+// 
+// Copyright (c) 2025 Mr. Myxa
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include <gtest/gtest.h>
+
+#include "../headers/incremental_vector.hpp"
+#include "utils/test_utils.hpp"
+
+#include <memory>
+#include <numeric>
+#include <string>
+
+using namespace test_utils::nothrow_object;
+
+static_assert(std::random_access_iterator<vectorx::incremental_vector<int>::iterator>);
+static_assert(std::random_access_iterator<vectorx::incremental_vector<int>::const_iterator>);
+
+TEST(IncrementalVector, MigratesInSteps)
+{
+    vectorx::incremental_vector<int, 4> vec{};
+
+    for (int i{}; i < 64; ++i)
+    {
+        vec.push_back(i);
+    }
+
+    EXPECT_FALSE(vec.is_migrating());
+    EXPECT_EQ(vec.capacity(), 64u);
+
+    vec.push_back(64); // crosses capacity: 1 element relocated out of 64
+    EXPECT_TRUE(vec.is_migrating());
+    EXPECT_EQ(vec.capacity(), 128u);
+
+    for (int i{}; i <= 64; ++i)
+    {
+        ASSERT_EQ(vec[static_cast<std::size_t>(i)], i);
+    }
+
+    for (int i{ 65 }; i < 65 + 15; ++i)
+    {
+        vec.push_back(i);
+    }
+
+    EXPECT_FALSE(vec.is_migrating());
+    EXPECT_EQ(std::accumulate(vec.begin(), vec.end(), 0), 79 * 80 / 2);
+}
+
+TEST(IncrementalVector, PopBackDuringMigration)
+{
+    vectorx::incremental_vector<std::string, 2> vec{};
+
+    for (int i{}; i < 33; ++i)
+    {
+        vec.push_back(std::to_string(i));
+    }
+
+    ASSERT_TRUE(vec.is_migrating());
+
+    while (std::size(vec) > 10)
+    {
+        vec.pop_back();
+    }
+
+    EXPECT_TRUE(vec.is_migrating()); // 2 of the remaining 10 have moved so far
+    EXPECT_EQ(vec[9], "9");
+
+    vec.push_back(vec[0]);
+    EXPECT_EQ(vec[10], "0");
+
+    vec.finish_migration();
+    EXPECT_FALSE(vec.is_migrating());
+    EXPECT_EQ(vec[5], "5");
+
+    while (!vec.empty())
+    {
+        vec.pop_back();
+    }
+
+    vec.push_back("x");
+    EXPECT_EQ(vec[0], "x");
+}
+
+TEST(IncrementalVector, EmplaceAliasesOldBlock)
+{
+    // Growing past 4 relocates the whole old block at once, the argument lives in it
+    vectorx::incremental_vector<std::string> vec{};
+
+    for (int i{}; i < 4; ++i)
+    {
+        vec.push_back(std::string(40, static_cast<char>('a' + i)));
+    }
+
+    vec.push_back(vec[0]);
+    
+    ASSERT_EQ(std::size(vec), 5u);
+    EXPECT_EQ(vec[4], std::string(40, 'a'));
+    EXPECT_EQ(vec[0], std::string(40, 'a'));
+    EXPECT_FALSE(vec.is_migrating());
+
+    // Same while a migration is left running
+    vectorx::incremental_vector<std::string, 1> slow{};
+
+    for (int i{}; i < 32; ++i)
+    {
+        slow.push_back(std::string(40, static_cast<char>('a' + i % 26)));
+    }
+
+    slow.push_back(slow[31]);
+    
+    EXPECT_EQ(slow[32], slow[31]);
+    EXPECT_TRUE(slow.is_migrating());
+}
+
+TEST(IncrementalVector, CopyMoveReserve)
+{
+    vectorx::incremental_vector<NothrowObjectWithAllocs, 3> a{};
+
+    for (int i{}; i < 40; ++i)
+    {
+        a.emplace_back(i);
+    }
+
+    ASSERT_TRUE(a.is_migrating());
+
+    auto b{ a };
+    EXPECT_FALSE(b.is_migrating());
+    EXPECT_TRUE(std::equal(a.begin(), a.end(), b.begin(), [](const auto& l, const auto& r) { return l.value() == r.value(); }));
+
+    auto c{ std::move(a) };
+    EXPECT_TRUE(a.empty());
+    EXPECT_TRUE(c.is_migrating());
+
+    c.reserve(1'000);
+    EXPECT_FALSE(c.is_migrating());
+    EXPECT_EQ(c.capacity(), 1'000u);
+    EXPECT_EQ(c[39].value(), 39);
+
+    a = std::move(c);
+    a.clear();
+    EXPECT_TRUE(a.empty());
+}
@@ -24,6 +24,9 @@
 
 #include "../headers/vectorx.hpp"
 
+#include <span>
+#include <ranges>
+
 TEST(IteratorRAI, RangeBased)
 {
     vectorx::vector<int> vec{ 1, 2, 3, 4, 5, 6 };
@@ -141,4 +144,53 @@ TEST(IteratorRAI, ConstIteratorConversion)
     
     auto it{ vec.begin() };
     testConstConversion<vectorx::vector<int>::const_iterator>(it);
-}
\ No newline at end of file
+}
+
+static_assert(std::contiguous_iterator<vectorx::vector<int>::iterator>);
+static_assert(std::contiguous_iterator<vectorx::vector<int>::const_iterator>);
+static_assert(std::ranges::contiguous_range<vectorx::vector<int>>);
+static_assert(std::ranges::contiguous_range<const vectorx::vector<int>>);
+static_assert(std::is_same_v<decltype(*std::declval<vectorx::vector<int>::const_iterator>()), const int&>);
+static_assert(!std::is_convertible_v<vectorx::vector<int>::const_iterator, vectorx::vector<int>::iterator>);
+
+TEST(IteratorRAI, ConstBeginEnd)
+{
+    const vectorx::vector<int> vec{ 1, 2, 3 };
+    
+    int sum{};
+    for (const auto& el : vec)
+    {
+        sum += el;
+    }
+
+    EXPECT_EQ(sum, 6);
+    EXPECT_EQ(std::to_address(vec.begin()), vec.data());
+    EXPECT_EQ(std::to_address(vec.cend()), vec.data() + 3);
+}
+
+TEST(IteratorRAI, MixedComparison)
+{
+    vectorx::vector<int> vec{ 1, 2, 3 };
+    
+    vectorx::vector<int>::const_iterator cit{ vec.begin() + 1 };
+    auto it{ vec.begin() };
+
+    EXPECT_TRUE(it < cit);
+    EXPECT_TRUE(cit == it + 1);
+    EXPECT_EQ(cit - it, 1);
+}
+
+TEST(IteratorRAI, StdAlgorithms)
+{
+    vectorx::vector<int> src{ 1, 2, 3, 4 };
+    vectorx::vector<int> dst{ 0, 0, 0, 0 };
+
+    std::copy(src.begin(), src.end(), dst.begin());
+    EXPECT_TRUE(std::equal(src.cbegin(), src.cend(), dst.cbegin()));
+
+    std::ranges::fill(dst, 7);
+    EXPECT_EQ(std::ranges::count(dst, 7), 4);
+    
+    std::span<const int> view{ src };
+    EXPECT_EQ(view[3], 4);
+}
@@ -0,0 +1,254 @@
+// MIT License
+// 
+// Copyright (c) 2025 Mr. Myxa
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include <gtest/gtest.h>
+
+#include "../headers/mapped_vector.hpp"
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <ranges>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace
+{
+    // Removes the file on both ends of a test
+    struct TempFile
+    {
+        explicit TempFile(const std::string& name)
+            : mPath{ std::filesystem::temp_directory_path() / ("vectorx_" + name + "_" + std::to_string(::getpid())) }
+        {
+            std::filesystem::remove(mPath);
+        }
+
+        ~TempFile() { std::filesystem::remove(mPath); }
+
+        std::filesystem::path mPath;
+    };
+}
+
+TEST(MappedVector, PersistsAcrossOpens)
+{
+    TempFile file{ "persist" };
+
+    {
+        vectorx::mapped_vector<std::uint64_t> vec{ file.mPath };
+        EXPECT_TRUE(vec.empty());
+
+        for (std::uint64_t i{}; i < 10'000; ++i)
+        {
+            vec.push_back(i * i);
+        }
+
+        EXPECT_GE(vec.capacity(), 10'000u);
+    }
+
+    EXPECT_EQ(std::filesystem::file_size(file.mPath), vectorx::mapped_vector<std::uint64_t>::data_offset + 10'000 * sizeof(std::uint64_t));
+
+    vectorx::mapped_vector<std::uint64_t> reopened{ file.mPath };
+    ASSERT_EQ(std::size(reopened), 10'000u);
+    EXPECT_EQ(reopened[9'999], 9'999u * 9'999u);
+
+    reopened.erase(reopened.begin(), reopened.begin() + 5'000);
+    EXPECT_EQ(reopened[0], 5'000u * 5'000u);
+}
+
+TEST(MappedVector, Truncate)
+{
+    TempFile file{ "truncate" };
+
+    {
+        vectorx::mapped_vector<int> vec{ file.mPath };
+        vec.append_range(std::views::iota(0, 100));
+    }
+
+    vectorx::mapped_vector<int> vec{ file.mPath, vectorx::file_mode::truncate };
+    EXPECT_TRUE(vec.empty());
+    EXPECT_EQ(vec.capacity(), 0u);
+}
+
+TEST(MappedVector, InsertResizeErase)
+{
+    TempFile file{ "edit" };
+    vectorx::mapped_vector<int> vec{ file.mPath };
+
+    vec.insert(vec.begin(), { 1, 2, 5 });
+    vec.insert(vec.begin() + 2, { 3, 4 });
+    vec.insert(vec.begin(), vec[4]);
+
+    ASSERT_EQ(std::size(vec), 6u);
+    EXPECT_EQ(vec[0], 5);
+    EXPECT_EQ(vec[3], 3);
+
+    vec.resize(8, -1);
+    EXPECT_EQ(vec[7], -1);
+
+    EXPECT_EQ(vectorx::erase(vec, -1), 2u);
+    EXPECT_EQ(vec.retain([](int v) { return v % 2 == 1; }), 2u);
+    ASSERT_EQ(std::size(vec), 4u);
+    EXPECT_EQ(vec[1], 1);
+
+    vec.shrink_to_fit();
+    EXPECT_EQ(vec.capacity(), 4u);
+    EXPECT_EQ(std::filesystem::file_size(file.mPath), vectorx::mapped_vector<int>::data_offset + 4 * sizeof(int));
+}
+
+TEST(MappedVector, RejectsForeignFiles)
+{
+    TempFile file{ "foreign" };
+    std::ofstream{ file.mPath, std::ios::binary } << "abc";
+
+    EXPECT_THROW(vectorx::mapped_vector<std::uint32_t>{ file.mPath }, std::runtime_error);
+
+    {
+        vectorx::mapped_vector<std::uint32_t> vec{ file.mPath, vectorx::file_mode::truncate };
+        vec.push_back(1);
+    }
+
+    EXPECT_THROW(vectorx::mapped_vector<std::uint64_t>{ file.mPath }, std::runtime_error);
+}
+
+TEST(MappedVector, CountSurvivesWithoutClose)
+{
+    TempFile file{ "crash" };
+    TempFile copy{ "crash_copy" };
+
+    vectorx::mapped_vector<std::uint64_t> vec{ file.mPath };
+    for (std::uint64_t i{}; i < 1'000; ++i)
+    {
+        vec.push_back(i);
+    }
+    vec.erase(vec.begin());
+    vec.reserve(4'096);
+
+    // The file as a killed process leaves it: full capacity, never trimmed
+    std::filesystem::copy_file(file.mPath, copy.mPath);
+    ASSERT_GT(std::filesystem::file_size(copy.mPath), vectorx::mapped_vector<std::uint64_t>::data_offset + 999 * sizeof(std::uint64_t));
+
+    vectorx::mapped_vector<std::uint64_t> reopened{ copy.mPath };
+    ASSERT_EQ(std::size(reopened), 999u);
+    EXPECT_EQ(reopened.capacity(), 4'096u);
+    EXPECT_EQ(reopened[0], 1u);
+    EXPECT_EQ(reopened[998], 999u);
+}
+
+TEST(MappedVector, VectorApi)
+{
+    TempFile file{ "api" };
+    vectorx::mapped_vector<int> vec{ file.mPath };
+
+    vec.assign(3, 7);
+    vec.push_back(8);
+    vec.emplace(vec.begin() + 1, 1);
+    vec.insert(vec.end(), 2, vec[0]);
+
+    const std::vector<int> expected{ 7, 1, 7, 7, 8, 7, 7 };
+    EXPECT_TRUE(std::ranges::equal(vec, expected));
+
+    std::istringstream numbers{ "4 5 6" };
+    vec.insert(vec.begin(), std::istream_iterator<int>{ numbers }, std::istream_iterator<int>{});
+    EXPECT_EQ(vec[0], 4);
+    EXPECT_EQ(vec[3], 7);
+    EXPECT_EQ(std::size(vec), 10u);
+
+    vec.insert_range(vec.begin() + 3, std::views::iota(0, 3));
+    EXPECT_EQ(vec[5], 2);
+
+    vec.assign({ 1, 2, 3 });
+    EXPECT_EQ(std::size(vec), 3u);
+
+    vec.assign_range(std::views::iota(10, 20) | std::views::filter([](int v) { return v % 2 == 0; }));
+    EXPECT_TRUE(std::ranges::equal(vec, std::vector<int>{ 10, 12, 14, 16, 18 }));
+
+    vec.reserve(10);
+    vec.push_back_unchecked(20);
+    vec.emplace_back_unchecked(22);
+    EXPECT_EQ(std::size(vec), 7u);
+
+    TempFile other_file{ "api_other" };
+    vectorx::mapped_vector<int> other{ other_file.mPath };
+    other.assign(vec.begin(), vec.end() - 1);
+
+    EXPECT_TRUE(other < vec);
+    EXPECT_EQ(other <=> other, std::strong_ordering::equal);
+
+    swap(vec, other);
+    EXPECT_EQ(std::size(vec), 6u);
+    EXPECT_EQ(other[6], 22);
+
+    // Each file keeps its own count through the swap
+    vec = vectorx::mapped_vector<int>{ file.mPath };
+    EXPECT_EQ(std::size(vec), 7u);
+}
+
+TEST(MappedVector, MoveKeepsFile)
+{
+    TempFile file{ "move" };
+
+    vectorx::mapped_vector<int> a{ file.mPath };
+    a.push_back(42);
+
+    auto b{ std::move(a) };
+    EXPECT_TRUE(a.empty());
+    ASSERT_EQ(std::size(b), 1u);
+    EXPECT_EQ(b[0], 42);
+
+    b.sync();
+}
+
+TEST(MappedVector, RejectsOtherByteOrder)
+{
+    TempFile file{ "byteswapped" };
+
+    {
+        vectorx::mapped_vector<std::uint32_t> vec{ file.mPath, vectorx::file_mode::truncate };
+        vec.push_back(1);
+    }
+
+    // Rewrites the header as a big endian writer would have: magic and endian tag swapped
+    {
+        std::fstream stream{ file.mPath, std::ios::binary | std::ios::in | std::ios::out };
+        vectorx::detail::MappedHeader header{};
+        stream.read(reinterpret_cast<char*>(&header), sizeof(header));
+
+        header.magic = vectorx::detail::byteswap(header.magic);
+        header.endian = vectorx::detail::byteswap(header.endian);
+
+        stream.seekp(0);
+        stream.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    }
+
+    try
+    {
+        vectorx::mapped_vector<std::uint32_t> vec{ file.mPath };
+        ADD_FAILURE() << "byte swapped file was accepted";
+    }
+    catch (const std::runtime_error& e)
+    {
+        EXPECT_STREQ(e.what(), "vectorx: mapped_vector file has a different byte order");
+    }
+}
@@ -0,0 +1,154 @@
+// MIT License
+// 
+// Copyright (c) 2025 Mr. Myxa
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include <gtest/gtest.h>
+
+#include "../headers/segmented_vector.hpp"
+#include "utils/test_utils.hpp"
+
+#include <numeric>
+#include <string>
+
+using namespace test_utils::nothrow_object;
+
+static_assert(std::random_access_iterator<vectorx::segmented_vector<int>::iterator>);
+static_assert(std::random_access_iterator<vectorx::segmented_vector<int>::const_iterator>);
+static_assert(std::ranges::random_access_range<vectorx::segmented_vector<int>>);
+
+TEST(SegmentedVector, IndexingAcrossSegments)
+{
+    vectorx::segmented_vector<int, 4> vec{};
+
+    for (int i{}; i < 1'000; ++i)
+    {
+        vec.push_back(i);
+    }
+
+    ASSERT_EQ(std::size(vec), 1'000u);
+    for (int i{}; i < 1'000; ++i)
+    {
+        ASSERT_EQ(vec[static_cast<std::size_t>(i)], i);
+    }
+
+    // 4 + 8 + ... + 512 = 1020
+    EXPECT_EQ(vec.capacity(), 1'020u);
+    EXPECT_EQ(vec.segment_count(), 8u);
+    EXPECT_EQ(std::size(vec.segment(0)), 4u);
+    EXPECT_EQ(std::size(vec.segment(7)), 1'000u - 508u);
+}
+
+TEST(SegmentedVector, StableReferences)
+{
+    vectorx::segmented_vector<std::string, 2> vec{ "first" };
+    const std::string* first{ &vec[0] };
+
+    for (int i{}; i < 100; ++i)
+    {
+        vec.push_back(vec[0]); // argument aliases an element across growth
+    }
+
+    EXPECT_EQ(&vec[0], first);
+    EXPECT_EQ(vec[100], "first");
+}
+
+TEST(SegmentedVector, Iterators)
+{
+    vectorx::segmented_vector<int, 8> vec{};
+    vec.resize(100, 1);
+
+    std::iota(vec.begin(), vec.end(), 0);
+    EXPECT_EQ(std::accumulate(vec.cbegin(), vec.cend(), 0), 4'950);
+
+    auto it{ vec.begin() + 50 };
+    EXPECT_EQ(*it, 50);
+    EXPECT_EQ(it[-43], 7);
+    EXPECT_EQ(*--it, 49);
+    EXPECT_EQ(vec.end() - it, 51);
+
+    vectorx::segmented_vector<int, 8>::const_iterator cit{ it };
+    EXPECT_TRUE(cit == it);
+
+    std::ranges::reverse(vec);
+    EXPECT_EQ(vec[0], 99);
+    EXPECT_EQ(vec[99], 0);
+
+    long sum{};
+    vec.for_each_segment([&sum](std::span<int> segment)
+    {
+        for (int v : segment) { sum += v; }
+    });
+    EXPECT_EQ(sum, 4'950);
+}
+
+TEST(SegmentedVector, CopyMoveResize)
+{
+    vectorx::segmented_vector<NothrowObjectWithAllocs, 4> a{};
+    a.resize(20, NothrowObjectWithAllocs{ 3 });
+
+    auto b{ a };
+    EXPECT_TRUE(std::equal(a.begin(), a.end(), b.begin(), [](const auto& l, const auto& r) { return l.value() == r.value(); }));
+
+    auto c{ std::move(b) };
+    EXPECT_TRUE(b.empty());
+    EXPECT_EQ(b.capacity(), 0u);
+    ASSERT_EQ(std::size(c), 20u);
+
+    c.resize(5, NothrowObjectWithAllocs{ 0 });
+    a = std::move(c);
+    EXPECT_EQ(std::size(a), 5u);
+
+    a.pop_back();
+    a.clear();
+    EXPECT_TRUE(a.empty());
+    EXPECT_GE(a.capacity(), 20u);
+
+    vectorx::segmented_vector<int> x{ 1, 2, 3 };
+    vectorx::segmented_vector<int> y{ 1, 2 };
+    EXPECT_TRUE(x != y);
+    y.push_back(3);
+    EXPECT_TRUE(x == y);
+}
+
+TEST(SegmentedVector, IteratorsSurviveMoveAndSwap)
+{
+    vectorx::segmented_vector<int, 4> a{};
+    vectorx::segmented_vector<int, 4> b{};
+    a.resize(50, 1);
+    b.resize(50, 2);
+
+    auto it{ a.begin() };
+    auto moved{ std::move(a) };
+
+    // Walking past the first segment re-reads the table, which now belongs to `moved`
+    it += 10;
+    EXPECT_EQ(*it, 1);
+    EXPECT_EQ(std::count(it, moved.end(), 1), 40);
+
+    auto other{ b.begin() };
+    swap(moved, b);
+
+    other += 20;
+    EXPECT_EQ(*other, 2);
+    EXPECT_EQ(std::count(other, moved.end(), 2), 30);
+    EXPECT_EQ(std::count(b.begin(), b.end(), 1), 50);
+}
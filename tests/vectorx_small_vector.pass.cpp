@@ -0,0 +1,173 @@
+// MIT License
+// 
+// Copyright (c) 2025 Mr. Myxa
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include <gtest/gtest.h>
+
+#include "../headers/small_vector.hpp"
+#include "utils/test_utils.hpp"
+
+using namespace test_utils::nothrow_object;
+
+TEST(SmallVector, StaysInline)
+{
+    vectorx::small_vector<int, 8> vec{};
+    
+    EXPECT_EQ(vec.capacity(), 8);
+    EXPECT_TRUE(vec.empty());
+
+    auto* inline_data{ vec.data() };
+    for (int i{}; i < 8; ++i)
+    {
+        vec.push_back(i);
+    }
+
+    EXPECT_EQ(vec.data(), inline_data);
+    EXPECT_EQ(vec.capacity(), 8);
+
+    vec.insert(vec.begin() + 2, -1);
+    
+    EXPECT_NE(vec.data(), inline_data);
+    EXPECT_EQ(vec.capacity(), 16);
+    EXPECT_EQ(std::size(vec), 9);
+    
+    EXPECT_EQ(vec[1], 1);
+    EXPECT_EQ(vec[2], -1);
+    EXPECT_EQ(vec[3], 2);
+    EXPECT_EQ(vec[8], 7);
+}
+
+TEST(SmallVector, CopyAndMoveInline)
+{
+    vectorx::small_vector<NothrowObjectWithAllocs, 4> vec{};
+    for (std::int32_t i{}; i < 3; ++i)
+    {
+        vec.emplace_back(i);
+    }
+
+    auto copy{ vec };
+    EXPECT_NE(copy.data(), vec.data());
+    EXPECT_EQ(copy.capacity(), 4);
+
+    auto moved{ std::move(vec) };
+    EXPECT_TRUE(vec.empty());
+    EXPECT_EQ(vec.capacity(), 4);
+    
+    ASSERT_EQ(std::size(moved), 3);
+    for (std::int32_t i{}; i < 3; ++i)
+    {
+        EXPECT_EQ(moved[i].value(), i);
+        EXPECT_EQ(copy[i].value(), i);
+    }
+
+    vec = std::move(moved);
+    EXPECT_EQ(vec[2].value(), 2);
+
+    copy = vec;
+    EXPECT_EQ(copy[1].value(), 1);
+}
+
+TEST(SmallVector, MoveStealsHeap)
+{
+    vectorx::small_vector<NothrowObjectWithAllocs, 2> vec{};
+    for (std::int32_t i{}; i < 10; ++i)
+    {
+        vec.emplace_back(i);
+    }
+
+    auto* heap_data{ vec.data() };
+    auto moved{ std::move(vec) };
+
+    EXPECT_EQ(moved.data(), heap_data);
+    EXPECT_EQ(vec.capacity(), 2);
+
+    vec.emplace_back(42);
+    vec = std::move(moved);
+
+    EXPECT_EQ(vec.data(), heap_data);
+    EXPECT_EQ(vec[9].value(), 9);
+}
+
+TEST(SmallVector, Swap)
+{
+    vectorx::small_vector<NothrowObjectWithAllocs, 4> a{};
+    vectorx::small_vector<NothrowObjectWithAllocs, 4> b{};
+    vectorx::small_vector<NothrowObjectWithAllocs, 4> c{};
+
+    a.emplace_back(1);
+    b.emplace_back(2);
+    b.emplace_back(3);
+    
+    for (std::int32_t i{}; i < 6; ++i)
+    {
+        c.emplace_back(i + 10);
+    }
+
+    swap(a, b);
+    
+    ASSERT_EQ(std::size(a), 2);
+    ASSERT_EQ(std::size(b), 1);
+    EXPECT_EQ(a[1].value(), 3);
+    EXPECT_EQ(b[0].value(), 1);
+
+    swap(a, c);
+
+    ASSERT_EQ(std::size(a), 6);
+    ASSERT_EQ(std::size(c), 2);
+    EXPECT_EQ(a[5].value(), 15);
+    EXPECT_EQ(c[0].value(), 2);
+    EXPECT_EQ(c.capacity(), 4);
+}
+
+TEST(SmallVector, EraseAndResize)
+{
+    vectorx::small_vector<std::unique_ptr<int>, 4> vec{};
+    vec.resize(3);
+    vec[1] = std::make_unique<int>(1);
+
+    EXPECT_EQ(vectorx::erase(vec, nullptr), 2);
+    ASSERT_EQ(std::size(vec), 1);
+    EXPECT_EQ(*vec[0], 1);
+
+    vec.resize(6);
+    vec.erase(vec.begin() + 1, vec.end());
+    
+    EXPECT_EQ(std::size(vec), 1);
+    EXPECT_EQ(vec.capacity(), 8);
+}
+
+TEST(SmallVector, ShrinkToFitReturnsInline)
+{
+    vectorx::small_vector<int, 4> vec{};
+    vec.resize(20, 1);
+    vec.resize(3);
+
+    vec.shrink_to_fit();
+
+    EXPECT_EQ(vec.capacity(), 4);
+    EXPECT_EQ(std::size(vec), 3);
+    EXPECT_EQ(vec[2], 1);
+
+    auto* inline_data{ vec.data() };
+    vec.shrink_to_fit();
+    EXPECT_EQ(vec.data(), inline_data);
+}
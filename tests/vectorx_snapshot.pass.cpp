@@ -0,0 +1,177 @@
+// MIT License
+// 
+// Copyright (c) 2025 Mr. Myxa
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include <gtest/gtest.h>
+
+#include "../headers/snapshot.hpp"
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <numeric>
+#include <string>
+
+namespace
+{
+    struct Point
+    {
+        double x;
+        double y;
+        std::uint32_t id;
+    };
+
+    struct alignas(128) Wide
+    {
+        std::uint64_t value;
+    };
+
+    // Removes the file on both ends of a test
+    struct TempFile
+    {
+        explicit TempFile(const std::string& name)
+            : mPath{ std::filesystem::temp_directory_path() / ("vectorx_snapshot_" + name + "_" + std::to_string(::getpid())) }
+        {
+            std::filesystem::remove(mPath);
+        }
+
+        ~TempFile() { std::filesystem::remove(mPath); }
+
+        std::filesystem::path mPath;
+    };
+}
+
+TEST(Snapshot, SaveLoadRoundTrip)
+{
+    const TempFile file{ "roundtrip" };
+    const auto& path{ file.mPath };
+
+    vectorx::vector<Point> points{};
+    for (std::uint32_t i{}; i < 1'000; ++i)
+    {
+        points.push_back({ i * 0.5, i * 2.0, i });
+    }
+
+    vectorx::save(points, path);
+
+    const auto loaded{ vectorx::load<Point>(path) };
+    ASSERT_EQ(std::size(loaded), 1'000u);
+    EXPECT_EQ(loaded.capacity(), 1'000u);
+    EXPECT_EQ(loaded[999].id, 999u);
+    EXPECT_EQ(loaded[10].y, 20.0);
+}
+
+TEST(Snapshot, EmptyAndOverAligned)
+{
+    const TempFile file{ "aligned" };
+    const auto& path{ file.mPath };
+
+    vectorx::save(vectorx::vector<int>{}, path);
+    EXPECT_TRUE(vectorx::load<int>(path).empty());
+    EXPECT_TRUE(vectorx::view<int>{ path }.empty());
+
+    std::vector<Wide> wide(3);
+    wide[2].value = 7;
+    vectorx::save(wide, path);
+
+    vectorx::view<Wide> v{ path };
+    ASSERT_EQ(std::size(v), 3u);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(v.data()) % alignof(Wide), 0u);
+    EXPECT_EQ(v[2].value, 7u);
+}
+
+TEST(Snapshot, ViewIsZeroCopy)
+{
+    const TempFile file{ "view" };
+    const auto& path{ file.mPath };
+
+    std::vector<std::uint64_t> src(100'000);
+    std::iota(src.begin(), src.end(), 0);
+    vectorx::save(src, path);
+
+    vectorx::view<std::uint64_t> v{ path };
+    EXPECT_TRUE(v.verify());
+    ASSERT_EQ(std::size(v), src.size());
+    EXPECT_TRUE(std::equal(v.begin(), v.end(), src.begin()));
+
+    auto moved{ std::move(v) };
+    EXPECT_TRUE(v.empty());
+    EXPECT_EQ(moved[99'999], 99'999u);
+}
+
+TEST(Snapshot, RejectsMismatchAndCorruption)
+{
+    const TempFile file{ "corrupt" };
+    const auto& path{ file.mPath };
+
+    vectorx::save(vectorx::vector<std::uint32_t>{ 1, 2, 3, 4 }, path);
+
+    EXPECT_THROW(vectorx::load<std::uint64_t>(path), vectorx::snapshot_error);
+    EXPECT_THROW(vectorx::view<std::uint16_t>{ path }, vectorx::snapshot_error);
+
+    {
+        std::fstream stream{ path, std::ios::binary | std::ios::in | std::ios::out };
+        stream.seekp(-1, std::ios::end);
+        stream.put('\x7f');
+    }
+
+    EXPECT_THROW(vectorx::load<std::uint32_t>(path), vectorx::snapshot_error);
+    EXPECT_FALSE(vectorx::view<std::uint32_t>{ path }.verify());
+
+    std::filesystem::resize_file(path, 64 + 2 * sizeof(std::uint32_t));
+    EXPECT_THROW(vectorx::load<std::uint32_t>(path), vectorx::snapshot_error);
+    EXPECT_THROW(vectorx::view<std::uint32_t>{ path }, vectorx::snapshot_error);
+
+    std::filesystem::remove(path);
+    EXPECT_THROW(vectorx::load<std::uint32_t>(path), vectorx::snapshot_error);
+}
+
+TEST(Snapshot, RejectsOtherByteOrder)
+{
+    const TempFile file{ "byteswapped" };
+    const auto& path{ file.mPath };
+
+    vectorx::save(vectorx::vector<std::uint32_t>{ 1, 2, 3, 4 }, path);
+
+    // Rewrites the header as a big endian writer would have: magic and endian tag swapped
+    {
+        std::fstream stream{ path, std::ios::binary | std::ios::in | std::ios::out };
+        vectorx::detail::SnapshotHeader header{};
+        stream.read(reinterpret_cast<char*>(&header), sizeof(header));
+
+        header.magic = vectorx::detail::byteswap(header.magic);
+        header.endian = vectorx::detail::byteswap(header.endian);
+
+        stream.seekp(0);
+        stream.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    }
+
+    try
+    {
+        (void)vectorx::load<std::uint32_t>(path);
+        ADD_FAILURE() << "byte swapped snapshot was accepted";
+    }
+    catch (const vectorx::snapshot_error& e)
+    {
+        EXPECT_STREQ(e.what(), "vectorx: snapshot has a different byte order");
+    }
+}
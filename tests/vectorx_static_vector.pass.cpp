@@ -0,0 +1,142 @@
+// MIT License
+// 
+// Copyright (c) 2025 Mr. Myxa
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include <gtest/gtest.h>
+
+#include "../headers/static_vector.hpp"
+#include "utils/test_utils.hpp"
+
+using namespace test_utils::nothrow_object;
+
+static_assert(std::is_trivially_copyable_v<vectorx::static_vector<int, 16>>);
+static_assert(!std::is_trivially_copyable_v<vectorx::static_vector<NothrowObjectWithAllocs, 16>>);
+static_assert(sizeof(vectorx::static_vector<std::uint8_t, 15>) == 16);
+static_assert(std::is_same_v<vectorx::static_vector<std::uint8_t, 15>::size_type, decltype(std::declval<vectorx::static_vector<std::uint8_t, 15>>().size())>);
+
+TEST(StaticVector, PushBackAndOverflow)
+{
+    vectorx::static_vector<int, 4> vec{};
+    for (int i{}; i < 4; ++i)
+    {
+        vec.push_back(i);
+    }
+
+    EXPECT_TRUE(vec.full());
+    EXPECT_THROW(vec.push_back(4), std::length_error);
+    EXPECT_THROW(vec.insert(vec.begin(), 1, 0), std::length_error);
+    EXPECT_THROW(vec.resize(5), std::length_error);
+
+    ASSERT_EQ(std::size(vec), 4);
+    for (int i{}; i < 4; ++i)
+    {
+        EXPECT_EQ(vec[i], i);
+    }
+}
+
+TEST(StaticVector, TerminatesPolicy)
+{
+    vectorx::static_vector<int, 1, vectorx::overflow::terminates> vec{ 1 };
+    EXPECT_DEATH(vec.push_back(2), "");
+}
+
+TEST(StaticVector, InsertErase)
+{
+    vectorx::static_vector<NothrowObjectWithAllocs, 16> vec{};
+    for (std::int32_t i{}; i < 6; ++i)
+    {
+        vec.emplace_back(i);
+    }
+
+    vec.insert(vec.begin() + 2, 2, vec[5]);
+    vec.emplace(vec.begin(), -1);
+
+    const std::int32_t expected[]{ -1, 0, 1, 5, 5, 2, 3, 4, 5 };
+    ASSERT_EQ(std::size(vec), std::size(expected));
+    
+    for (std::size_t i{}; i < std::size(vec); ++i)
+    {
+        EXPECT_EQ(vec[i].value(), expected[i]);
+    }
+
+    vec.erase(vec.begin() + 3, vec.begin() + 5);
+    vec.erase(vec.begin());
+    
+    EXPECT_EQ(vectorx::erase_if(vec, [](const auto& el) { return el.value() > 3; }), 2);
+    
+    ASSERT_EQ(std::size(vec), 4);
+    for (std::size_t i{}; i < std::size(vec); ++i)
+    {
+        EXPECT_EQ(vec[i].value(), static_cast<std::int32_t>(i));
+    }
+}
+
+TEST(StaticVector, CopyMoveSwap)
+{
+    vectorx::static_vector<NothrowObjectWithAllocs, 8> a{};
+    a.resize(3, NothrowObjectWithAllocs{ 7 });
+
+    auto b{ a };
+    EXPECT_TRUE(std::equal(a.begin(), a.end(), b.begin(), [](const auto& l, const auto& r) { return l.value() == r.value(); }));
+
+    vectorx::static_vector<NothrowObjectWithAllocs, 8> c{};
+    c.emplace_back(1);
+
+    swap(b, c);
+    EXPECT_EQ(std::size(b), 1);
+    EXPECT_EQ(std::size(c), 3);
+
+    a = std::move(b);
+    EXPECT_EQ(std::size(a), 1);
+    EXPECT_EQ(a[0].value(), 1);
+    EXPECT_TRUE(b.empty());
+
+    vectorx::static_vector<int, 8> ints{ 1, 2, 3 };
+    auto ints_copy{ ints };
+    
+    EXPECT_TRUE(ints == ints_copy);
+    ints_copy.pop_back();
+    EXPECT_TRUE(ints != ints_copy);
+}
+
+TEST(StaticVector, ResizeForOverwrite)
+{
+    vectorx::static_vector<int, 8> ints{ 1, 2 };
+    ints.resize_for_overwrite(4);
+    ASSERT_EQ(std::size(ints), 4);
+    EXPECT_EQ(ints[1], 2);
+
+    EXPECT_THROW(ints.resize_for_overwrite(9), std::length_error);
+    EXPECT_EQ(std::size(ints), 4);
+}
+
+TEST(StaticVector, Comparison)
+{
+    vectorx::static_vector<std::uint8_t, 8> a{ 1, 2, 3 };
+    vectorx::static_vector<std::uint8_t, 8> b{ 1, 2 };
+
+    EXPECT_TRUE(a != b);
+    EXPECT_TRUE(a > b);
+
+    b.push_back(4);
+    EXPECT_TRUE(a < b);
+}